@@ -0,0 +1,90 @@
+/// @file BenchmarkSets.h
+/// @brief The generated sets and evaluation points shared by the benchmarks.
+#pragma once
+#include "SyntheticSets.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace PDFxTMD::Benchmarks
+{
+/// Collinear, Hessian errors, interpolated alpha_s
+constexpr const char *HESSIAN_SET = "BenchCPDFHessian";
+/// Collinear, symmetric Hessian errors, alpha_s from the ODE
+constexpr const char *SYMM_HESSIAN_SET = "BenchCPDFSymmHessian";
+/// Collinear, replicas, analytic alpha_s
+constexpr const char *REPLICAS_SET = "BenchCPDFReplicas";
+/// TMD, Hessian errors, default trilinear interpolation
+constexpr const char *TMD_SET = "BenchTMD";
+/// TMD central member with tricubic interpolation
+constexpr const char *TMD_TRICUBIC_SET = "BenchTMDTricubic";
+
+using Synthetic::SyntheticSet;
+
+inline SyntheticSet CollinearSet(const char *name, int nMembers, const char *errorType,
+                                 const char *alphasType)
+{
+    SyntheticSet set;
+    set.name = name;
+    set.nMembers = nMembers;
+    set.errorType = errorType;
+    set.alphasType = alphasType;
+    // Two subgrids in Q, as in most LHAPDF sets
+    set.q = {{1, 4.5, 10}, {4.5, 1e4, 40}};
+    return set;
+}
+
+inline SyntheticSet TMDSet(const char *name, int nMembers, const char *interpolator)
+{
+    SyntheticSet set;
+    set.name = name;
+    set.format = "lhagrid_tmd1";
+    set.nMembers = nMembers;
+    set.interpolator = interpolator;
+    set.x = {1e-5, 1, 40};
+    set.kt = {0.01, 100, 30};
+    set.q = {{1.4, 1e3, 20}};
+    return set;
+}
+
+inline std::vector<SyntheticSet> BenchmarkSets()
+{
+    return {CollinearSet(HESSIAN_SET, 31, "hessian", "ipol"),
+            CollinearSet(SYMM_HESSIAN_SET, 21, "symmhessian", "ode"),
+            CollinearSet(REPLICAS_SET, 101, "replicas", "analytic"),
+            TMDSet(TMD_SET, 11, ""), TMDSet(TMD_TRICUBIC_SET, 1, "TTricubicInterpolator")};
+}
+
+/// Upper end of the thread counts of the scaling benchmarks
+inline const int MAX_THREADS =
+    static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+
+/// Evaluation points drawn log-uniformly inside the grids of BenchmarkSets
+struct Points
+{
+    static constexpr size_t size = 1024;
+    std::vector<double> x, kt2, mu2;
+
+    static const Points &InGrid()
+    {
+        static const Points points = [] {
+            Points p;
+            std::mt19937 generator(42);
+            std::uniform_real_distribution<double> uniform(0, 1);
+            const auto logUniform = [&](double min, double max) {
+                return min * std::pow(max / min, uniform(generator));
+            };
+            for (size_t i = 0; i < size; ++i)
+            {
+                p.x.push_back(logUniform(1e-4, 0.9));
+                p.kt2.push_back(logUniform(1e-3, 1e3));
+                p.mu2.push_back(logUniform(4, 1e6));
+            }
+            return p;
+        }();
+        return points;
+    }
+};
+} // namespace PDFxTMD::Benchmarks
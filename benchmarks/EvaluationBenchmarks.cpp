@@ -0,0 +1,329 @@
+// Loading members and evaluating single members and alpha_s.
+#include "BenchmarkSets.h"
+#include <PDFxTMDLib/Common/ConfigWrapper.h>
+#include <PDFxTMDLib/Common/GridCache.h>
+#include <PDFxTMDLib/Common/PartonUtils.h>
+#include <PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h>
+#include <PDFxTMDLib/Factory.h>
+#include <PDFxTMDLib/Implementation/Coupling/Analytic/AnalyticQCDCoupling.h>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace PDFxTMD::Benchmarks
+{
+namespace
+{
+// Members shared by all threads of a benchmark, loaded on first use
+const ICPDF &CPDFMember()
+{
+    static const ICPDF pdf = GenericCPDFFactory().mkCPDF(HESSIAN_SET, 0);
+    return pdf;
+}
+
+const ITMD &TMDMember(const char *setName)
+{
+    static const ITMD trilinear = GenericTMDFactory().mkTMD(TMD_SET, 0);
+    static const ITMD tricubic = GenericTMDFactory().mkTMD(TMD_TRICUBIC_SET, 0);
+    return std::string(setName) == TMD_TRICUBIC_SET ? tricubic : trilinear;
+}
+
+/// Forgets everything a load reuses: the grids, the parsed info and config files and the
+/// resolved paths, so the next load starts cold
+void ClearLoadCaches()
+{
+    GridCache::Global().Clear();
+    ConfigWrapper::clearCache();
+    ClearPathCache();
+}
+
+/// Index of the point used by the current iteration
+size_t Next(size_t &i)
+{
+    return i++ % Points::size;
+}
+
+void BM_LoadCPDFMember(benchmark::State &state, bool cached)
+{
+    GenericCPDFFactory factory;
+    for (auto _ : state)
+    {
+        if (!cached)
+        {
+            state.PauseTiming();
+            ClearLoadCaches();
+            state.ResumeTiming();
+        }
+        benchmark::DoNotOptimize(factory.mkCPDF(HESSIAN_SET, 0));
+    }
+}
+BENCHMARK_CAPTURE(BM_LoadCPDFMember, parse, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadCPDFMember, cached, true)->Unit(benchmark::kMicrosecond);
+
+void BM_LoadTMDMember(benchmark::State &state, bool cached)
+{
+    GenericTMDFactory factory;
+    for (auto _ : state)
+    {
+        if (!cached)
+        {
+            state.PauseTiming();
+            ClearLoadCaches();
+            state.ResumeTiming();
+        }
+        benchmark::DoNotOptimize(factory.mkTMD(TMD_SET, 0));
+    }
+}
+BENCHMARK_CAPTURE(BM_LoadTMDMember, parse, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadTMDMember, cached, true)->Unit(benchmark::kMicrosecond);
+
+void BM_CPDFSingleFlavor(benchmark::State &state)
+{
+    const ICPDF &pdf = CPDFMember();
+    const Points &points = Points::InGrid();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t p = Next(i);
+        benchmark::DoNotOptimize(pdf.pdf(PartonFlavor::g, points.x[p], points.mu2[p]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CPDFSingleFlavor);
+BENCHMARK(BM_CPDFSingleFlavor)->ThreadRange(2, MAX_THREADS)->UseRealTime();
+
+void BM_CPDFAllFlavors(benchmark::State &state)
+{
+    const ICPDF &pdf = CPDFMember();
+    const Points &points = Points::InGrid();
+    std::array<double, DEFAULT_TOTAL_PDFS> output;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t p = Next(i);
+        pdf.pdf(points.x[p], points.mu2[p], output);
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CPDFAllFlavors);
+BENCHMARK(BM_CPDFAllFlavors)->ThreadRange(2, MAX_THREADS)->UseRealTime();
+
+// One point in each region of CContinuationExtrapolator; the grids cover x in [1e-6, 1] and
+// q2 in [1, 1e8]
+void BM_CPDFExtrapolation(benchmark::State &state, double x, double q2)
+{
+    const ICPDF &pdf = CPDFMember();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(pdf.pdf(PartonFlavor::g, x, q2));
+}
+BENCHMARK_CAPTURE(BM_CPDFExtrapolation, small_x, 1e-8, 100.);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolation, large_q2, 1e-2, 1e10);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolation, small_x_large_q2, 1e-8, 1e10);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolation, small_q2, 1e-2, 0.5);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolation, small_q2_small_x, 1e-8, 0.5);
+
+void BM_CPDFExtrapolationAllFlavors(benchmark::State &state, double x, double q2)
+{
+    const ICPDF &pdf = CPDFMember();
+    std::array<double, DEFAULT_TOTAL_PDFS> output;
+    for (auto _ : state)
+    {
+        pdf.pdf(x, q2, output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+BENCHMARK_CAPTURE(BM_CPDFExtrapolationAllFlavors, small_x, 1e-8, 100.);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolationAllFlavors, large_q2, 1e-2, 1e10);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolationAllFlavors, small_x_large_q2, 1e-8, 1e10);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolationAllFlavors, small_q2, 1e-2, 0.5);
+BENCHMARK_CAPTURE(BM_CPDFExtrapolationAllFlavors, small_q2_small_x, 1e-8, 0.5);
+
+void BM_TMDSingleFlavor(benchmark::State &state, const char *setName)
+{
+    const ITMD &pdf = TMDMember(setName);
+    const Points &points = Points::InGrid();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t p = Next(i);
+        benchmark::DoNotOptimize(
+            pdf.tmd(PartonFlavor::g, points.x[p], points.kt2[p], points.mu2[p]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_TMDSingleFlavor, trilinear, TMD_SET);
+BENCHMARK_CAPTURE(BM_TMDSingleFlavor, trilinear, TMD_SET)
+    ->ThreadRange(2, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_TMDSingleFlavor, tricubic, TMD_TRICUBIC_SET);
+
+void BM_TMDAllFlavors(benchmark::State &state, const char *setName)
+{
+    const ITMD &pdf = TMDMember(setName);
+    const Points &points = Points::InGrid();
+    std::array<double, DEFAULT_TOTAL_PDFS> output;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t p = Next(i);
+        pdf.tmd(points.x[p], points.kt2[p], points.mu2[p], output);
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_TMDAllFlavors, trilinear, TMD_SET);
+BENCHMARK_CAPTURE(BM_TMDAllFlavors, tricubic, TMD_TRICUBIC_SET);
+
+// All points of Points::InGrid per iteration through the batch entry point
+void BM_TMDBatch(benchmark::State &state, const char *setName)
+{
+    const ITMD &pdf = TMDMember(setName);
+    const Points &points = Points::InGrid();
+    std::vector<double> output(Points::size);
+    for (auto _ : state)
+    {
+        pdf.tmd(PartonFlavor::g, points.x.data(), points.kt2.data(), points.mu2.data(),
+                output.data(), Points::size);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * Points::size);
+}
+BENCHMARK_CAPTURE(BM_TMDBatch, trilinear, TMD_SET);
+BENCHMARK_CAPTURE(BM_TMDBatch, tricubic, TMD_TRICUBIC_SET);
+
+// The coupling type comes from the AlphaS_Type of the set
+void BM_AlphaS(benchmark::State &state, const char *setName)
+{
+    const IQCDCoupling coupling = CouplingFactory().mkCoupling(setName);
+    const Points &points = Points::InGrid();
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(coupling.AlphaQCDMu2(points.mu2[Next(i)]));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_AlphaS, ipol, HESSIAN_SET);
+BENCHMARK_CAPTURE(BM_AlphaS, ode, SYMM_HESSIAN_SET);
+BENCHMARK_CAPTURE(BM_AlphaS, analytic, REPLICAS_SET);
+
+/// The analytic alpha_s as computed before the per-flavour constants were precomputed, kept
+/// verbatim as the reference the optimized scalar and batch paths must reproduce bit for bit
+double ReferenceAnalyticAlphaS(const YamlCouplingInfo &info, double q2)
+{
+    std::map<int, double> lambdas;
+    for (const auto &[nf, lambda] :
+         {std::pair{3, info.alphasLambda3}, {4, info.alphasLambda4}, {5, info.alphasLambda5}})
+        if (lambda != -1)
+            lambdas[nf] = lambda;
+    const int nf = numFlavorsQ2(q2, info, lambdas.begin()->first, lambdas.rbegin()->first);
+    int lambdaNf = info.flavorScheme == AlphasFlavorScheme::fixed ? info.AlphaS_NumFlavors : nf;
+    while (info.flavorScheme == AlphasFlavorScheme::variable && lambdas.count(lambdaNf) == 0)
+        --lambdaNf;
+    const double lambdaQCD_ = lambdas.at(lambdaNf);
+
+    if (q2 <= lambdaQCD_ * lambdaQCD_)
+        return std::numeric_limits<double>::max();
+
+    const std::vector<double> beta = betas(nf);
+    const double beta02 = SQR(beta[0]);
+    const double beta12 = SQR(beta[1]);
+
+    const double x = q2 / (lambdaQCD_ * lambdaQCD_);
+    const double lnx = log(x);
+    const double lnlnx = log(lnx);
+    const double lnlnx2 = lnlnx * lnlnx;
+    const double lnlnx3 = lnlnx * lnlnx * lnlnx;
+    const double y = 1 / lnx;
+
+    if (info.alphasOrder == OrderQCD::LO)
+        return info.AlphaS_MZ;
+    const double A = 1 / beta[0];
+    const double a_0 = 1;
+    double tmp = a_0;
+    if ((int)info.alphasOrder > 1)
+    {
+        const double a_1 = beta[1] * lnlnx / beta02;
+        tmp -= a_1 * y;
+    }
+    if ((int)info.alphasOrder > 2)
+    {
+        const double B = beta12 / (beta02 * beta02);
+        const double a_20 = lnlnx2 - lnlnx;
+        const double a_21 = beta[2] * beta[0] / beta12;
+        const double a_22 = 1;
+        tmp += B * y * y * (a_20 + a_21 - a_22);
+    }
+    if ((int)info.alphasOrder > 3)
+    {
+        const double C = 1. / (beta02 * beta02 * beta02);
+        const double a_30 = (beta12 * beta[1]) * (lnlnx3 - (5 / 2.) * lnlnx2 - 2 * lnlnx + 0.5);
+        const double a_31 = 3 * beta[0] * beta[1] * beta[2] * lnlnx;
+        const double a_32 = 0.5 * beta02 * beta[3];
+        tmp -= C * y * y * y * (a_30 + a_31 - a_32);
+    }
+    const double alphaS = A * y * tmp;
+    return alphaS;
+}
+
+/// Compares the scalar and the batch analytic alpha_s with the reference bit for bit, at every
+/// order and in both flavour schemes, on a scan from below lambda to far above the top threshold
+bool AnalyticAlphaSMatchesReference(const char *setName, std::string &mismatch)
+{
+    std::vector<double> q2;
+    for (double log10Q2 = -2; log10Q2 < 10; log10Q2 += 0.01)
+        q2.push_back(std::pow(10., log10Q2));
+    std::vector<double> batch(q2.size());
+
+    YamlCouplingInfo info = *SetMetadataReader(setName).first->couplingInfo.first;
+    for (int order = 0; order <= static_cast<int>(OrderQCD::N4LO); ++order)
+        for (AlphasFlavorScheme scheme : {AlphasFlavorScheme::variable, AlphasFlavorScheme::fixed})
+        {
+            info.alphasOrder = static_cast<OrderQCD>(order);
+            info.flavorScheme = scheme;
+            AnalyticQCDCoupling coupling;
+            coupling.initialize(info);
+            coupling.AlphaQCDMu2(q2.data(), batch.data(), q2.size());
+            for (size_t i = 0; i < q2.size(); ++i)
+            {
+                const double reference = ReferenceAnalyticAlphaS(info, q2[i]);
+                const double scalar = coupling.AlphaQCDMu2(q2[i]);
+                if (std::memcmp(&scalar, &reference, sizeof(double)) != 0 ||
+                    std::memcmp(&batch[i], &reference, sizeof(double)) != 0)
+                {
+                    mismatch = "analytic alpha_s differs from the reference at order " +
+                               std::to_string(order) + ", q2 = " + std::to_string(q2[i]);
+                    return false;
+                }
+            }
+        }
+    return true;
+}
+
+void BM_AlphaSBatch(benchmark::State &state, const char *setName)
+{
+    std::string mismatch;
+    if (std::string(setName) == REPLICAS_SET && !AnalyticAlphaSMatchesReference(setName, mismatch))
+    {
+        state.SkipWithError(mismatch.c_str());
+        return;
+    }
+    const IQCDCoupling coupling = CouplingFactory().mkCoupling(setName);
+    const Points &points = Points::InGrid();
+    std::vector<double> output(Points::size);
+    for (auto _ : state)
+    {
+        coupling.AlphaQCDMu2(points.mu2.data(), output.data(), Points::size);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * Points::size);
+}
+BENCHMARK_CAPTURE(BM_AlphaSBatch, ipol, HESSIAN_SET);
+BENCHMARK_CAPTURE(BM_AlphaSBatch, ode, SYMM_HESSIAN_SET);
+BENCHMARK_CAPTURE(BM_AlphaSBatch, analytic, REPLICAS_SET);
+} // namespace
+} // namespace PDFxTMD::Benchmarks
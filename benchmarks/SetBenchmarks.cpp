@@ -0,0 +1,113 @@
+// Uncertainties of whole sets, serial and spread over the global ThreadPool.
+#include "BenchmarkSets.h"
+#include <PDFxTMDLib/Common/ThreadPool.h>
+#include <PDFxTMDLib/PDFSet.h>
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PDFxTMD::Benchmarks
+{
+namespace
+{
+/// The set called @p name with all members loaded, so that loading is not timed
+template <typename Tag> PDFSet<Tag> &LoadedSet(const char *name)
+{
+    static std::map<std::string, std::unique_ptr<PDFSet<Tag>>> sets;
+    auto &set = sets[name];
+    if (!set)
+    {
+        set = std::make_unique<PDFSet<Tag>>(name);
+        set->CreateAllPDFSets();
+    }
+    return *set;
+}
+
+void BM_CPDFUncertainty(benchmark::State &state, const char *setName)
+{
+    auto &set = LoadedSet<CollinearPDFTag>(setName);
+    const Points &points = Points::InGrid();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t p = i++ % Points::size;
+        benchmark::DoNotOptimize(set.Uncertainty(PartonFlavor::g, points.x[p], points.mu2[p]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["members"] = static_cast<double>(set.size());
+}
+BENCHMARK_CAPTURE(BM_CPDFUncertainty, hessian, HESSIAN_SET);
+BENCHMARK_CAPTURE(BM_CPDFUncertainty, symmhessian, SYMM_HESSIAN_SET);
+BENCHMARK_CAPTURE(BM_CPDFUncertainty, replicas, REPLICAS_SET);
+
+void BM_TMDUncertainty(benchmark::State &state)
+{
+    auto &set = LoadedSet<TMDPDFTag>(TMD_SET);
+    const Points &points = Points::InGrid();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t p = i++ % Points::size;
+        benchmark::DoNotOptimize(
+            set.Uncertainty(PartonFlavor::g, points.x[p], points.kt2[p], points.mu2[p]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["members"] = static_cast<double>(set.size());
+}
+BENCHMARK(BM_TMDUncertainty);
+
+// All points of Points::InGrid per iteration through the block Uncertainty, on state.range(0)
+// threads of the global pool (the caller included)
+void BM_CPDFUncertaintyBlock(benchmark::State &state, const char *setName)
+{
+    auto &set = LoadedSet<CollinearPDFTag>(setName);
+    const Points &points = Points::InGrid();
+    ThreadPool::SetGlobalThreads(static_cast<size_t>(state.range(0)) - 1);
+    std::vector<PDFUncertainty> output;
+    for (auto _ : state)
+    {
+        set.Uncertainty(PartonFlavor::g, points.x.data(), points.mu2.data(), Points::size, -1,
+                        output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    ThreadPool::SetGlobalThreads(0);
+    state.SetItemsProcessed(state.iterations() * Points::size);
+}
+BENCHMARK_CAPTURE(BM_CPDFUncertaintyBlock, replicas, REPLICAS_SET)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_THREADS)
+    ->ArgName("threads")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CPDFUncertaintyBlock, hessian, HESSIAN_SET)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_THREADS)
+    ->ArgName("threads")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+void BM_TMDUncertaintyBlock(benchmark::State &state)
+{
+    auto &set = LoadedSet<TMDPDFTag>(TMD_SET);
+    const Points &points = Points::InGrid();
+    ThreadPool::SetGlobalThreads(static_cast<size_t>(state.range(0)) - 1);
+    std::vector<PDFUncertainty> output;
+    for (auto _ : state)
+    {
+        set.Uncertainty(PartonFlavor::g, points.x.data(), points.kt2.data(), points.mu2.data(),
+                        Points::size, -1, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    ThreadPool::SetGlobalThreads(0);
+    state.SetItemsProcessed(state.iterations() * Points::size);
+}
+BENCHMARK(BM_TMDUncertaintyBlock)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_THREADS)
+    ->ArgName("threads")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+} // namespace
+} // namespace PDFxTMD::Benchmarks
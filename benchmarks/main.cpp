@@ -0,0 +1,43 @@
+// Generates the benchmark sets in a temporary directory and runs the registered benchmarks
+// from there, since the library also looks for sets in the working directory.
+#include "BenchmarkSets.h"
+#include <PDFxTMDLib/pdfxtmd.h>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    namespace fs = std::filesystem;
+    const fs::path workingDirectory = fs::current_path();
+    const fs::path setsDirectory =
+        fs::temp_directory_path() /
+        ("PDFxTMDLib-benchmarks-" +
+         std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    try
+    {
+        for (const auto &set : PDFxTMD::Benchmarks::BenchmarkSets())
+            PDFxTMD::Synthetic::WriteSyntheticSet(setsDirectory, set);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Cannot generate the benchmark sets: " << e.what() << std::endl;
+        fs::remove_all(setsDirectory);
+        return 1;
+    }
+    fs::current_path(setsDirectory);
+
+    benchmark::AddCustomContext("pdfxtmd_version", pdfxtmd_version());
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    fs::current_path(workingDirectory);
+    fs::remove_all(setsDirectory);
+    return 0;
+}
@@ -1,3 +1,5 @@
+#include <PDFxTMDLib/ConcretePDF.h>
+#include <PDFxTMDLib/Factory.h>
 #include <PDFxTMDLib/GenericPDF.h>
 #include <PDFxTMDLib/Implementation/Extrapolator/Collinear/CErrExtrapolator.h>
 #include <PDFxTMDLib/Implementation/Interpolator/Collinear/CLHAPDFBilinearInterpolator.h>
@@ -103,5 +105,19 @@ int main()
         std::cout << "TMD type alias all flavors: " << PartonFlavorToString(flavorIndex) << ": "
                   << pbAllTypeAlias[flavorIndex] << std::endl;
     }
+
+    // Factory objects with their concrete type: the type is looked up once and the loop calls the
+    // interpolator directly instead of going through ICPDF
+    ICPDF factoryPDF = GenericCPDFFactory().mkCPDF("MMHT2014lo68cl", 0);
+    double gluonSum = withConcrete(factoryPDF, [&](const auto &concretePDF) {
+        double sum = 0;
+        for (int i = 1; i <= 100; i++)
+            sum += concretePDF.pdf(PartonFlavor::g, i / 101., mu2);
+        return sum;
+    });
+    std::cout << "Sum of gluon values (withConcrete): " << gluonSum << std::endl;
+    // or, when the set's reader, interpolator and extrapolator are known, directly
+    CollinearPDF typedPDF = GenericCPDFFactory().mkTypedCPDF<CollinearPDF>("MMHT2014lo68cl", 0);
+    std::cout << "Gluon (mkTypedCPDF):  " << typedPDF.pdf(PartonFlavor::g, x, mu2) << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -5,8 +5,12 @@ program test_factory
 
     type(c_ptr) :: cpdfFactory, cpdf
     character(len=100, kind=c_char) :: pdfSetName
-    integer(c_int) :: setMember, flavor
+    integer(c_int) :: setMember, flavor, status
+    character(len=256, kind=c_char) :: message
     real(c_double) :: x, mu2, result
+    integer(c_int), parameter :: nPoints = 4
+    real(c_double) :: xs(nPoints), mu2s(nPoints), values(nPoints), allFlavors(13, nPoints)
+    integer :: i
 
     pdfSetName = "CJ12min"//c_null_char
     setMember = 0
@@ -24,7 +28,22 @@ program test_factory
     result = cpdf_wrapper(cpdf, flavor, x, mu2)
     print *, "PDF value for flavor=", flavor, " at x=", x, " mu2=", mu2, " is:", result
 
+    ! Many points in one call: one flavor, then all 13 flavors (pid -6 to 6) per point
+    xs = [1.0d-3, 1.0d-2, 0.1d0, 0.5d0]
+    mu2s = [10.0d0, 100.0d0, 1000.0d0, 10000.0d0]
+    call cpdf_batch_wrapper(cpdf, flavor, xs, mu2s, values, nPoints, status)
+    if (status == 0) call cpdf_all_batch_wrapper(cpdf, xs, mu2s, allFlavors, nPoints, status)
+    if (status /= 0) then
+        call last_error_message(message, len(message))
+        print *, "Batch evaluation failed: ", trim(message)
+        stop 1
+    end if
+    do i = 1, nPoints
+        print *, "x=", xs(i), " mu2=", mu2s(i), " u:", values(i), " g:", allFlavors(7, i)
+    end do
+
     ! Clean up
+    call delete_cpdf(cpdf)
     call delete_cpdf_factory(cpdfFactory)
 
 end program test_factory
\ No newline at end of file
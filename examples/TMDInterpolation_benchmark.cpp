@@ -0,0 +1,139 @@
+// Compares the accuracy and speed of the trilinear and tricubic TMD interpolators against a known
+// function, tabulated in memory on grids of increasing density.
+#include <PDFxTMDLib/Implementation/Interpolator/TMD/TTricubicInterpolator.h>
+#include <PDFxTMDLib/Implementation/Interpolator/TMD/TTrilinearInterpolator.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace PDFxTMD;
+
+namespace
+{
+const double X_MIN = 1e-5, X_MAX = 0.5;
+const double KT2_MIN = 1e-2, KT2_MAX = 1e3;
+const double MU2_MIN = 2., MU2_MAX = 1e5;
+
+// kt2 times a gluon-like TMD, which is what lhagrid_tmd1 grids store
+double gridFunction(double x, double kt2, double mu2)
+{
+    const double width2 = 0.5 + 0.2 * std::log(mu2);
+    return std::pow(x, -0.3) * std::pow(1 - x, 3) * (1 + 0.1 * std::log(mu2)) * kt2 /
+           std::pow(kt2 + width2, 1.5);
+}
+
+std::vector<double> logSpaced(double min, double max, size_t n)
+{
+    std::vector<double> knots(n);
+    for (size_t i = 0; i < n; ++i)
+        knots[i] = min * std::pow(max / min, static_cast<double>(i) / (n - 1));
+    return knots;
+}
+
+/// Reader serving gridFunction on n x n x n log-spaced knots
+class AnalyticTMDReader : public IReader<AnalyticTMDReader>
+{
+  public:
+    explicit AnalyticTMDReader(size_t nKnots)
+    {
+        m_shape.x_vec = logSpaced(X_MIN, X_MAX, nKnots);
+        m_shape.kt2_vec = logSpaced(KT2_MIN, KT2_MAX, nKnots);
+        m_shape.mu2_vec = logSpaced(MU2_MIN, MU2_MAX, nKnots);
+        m_shape._pids = {21};
+        for (double x : m_shape.x_vec)
+            for (double kt2 : m_shape.kt2_vec)
+                for (double mu2 : m_shape.mu2_vec)
+                    m_shape.grids_flat.push_back(gridFunction(x, kt2, mu2));
+        m_shape.finalizeXKt2P2();
+    }
+    void read(const std::string &, int)
+    {
+    }
+    const DefaultAllFlavorTMDShape &getData() const
+    {
+        return m_shape;
+    }
+    const std::vector<double> &getValues(PhaseSpaceComponent comp) const
+    {
+        return comp == PhaseSpaceComponent::X    ? m_shape.x_vec
+               : comp == PhaseSpaceComponent::Kt2 ? m_shape.kt2_vec
+                                                  : m_shape.mu2_vec;
+    }
+    std::pair<double, double> getBoundaryValues(PhaseSpaceComponent comp) const
+    {
+        const std::vector<double> &knots = getValues(comp);
+        return {knots.front(), knots.back()};
+    }
+
+  private:
+    DefaultAllFlavorTMDShape m_shape;
+};
+
+struct Result
+{
+    double maxError = 0;
+    double meanError = 0;
+    double nsPerCall = 0;
+};
+
+template <typename Interpolator>
+Result measure(const AnalyticTMDReader &reader, const std::vector<std::array<double, 3>> &points)
+{
+    Interpolator interpolator;
+    interpolator.initialize(&reader);
+    Result result;
+    size_t counted = 0;
+    double sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &p : points)
+        sum += interpolator.interpolate(PartonFlavor::g, p[0], p[1], p[2]);
+    const auto stop = std::chrono::steady_clock::now();
+    result.nsPerCall = std::chrono::duration<double, std::nano>(stop - start).count() /
+                       static_cast<double>(points.size());
+
+    for (const auto &p : points)
+    {
+        const double exact = gridFunction(p[0], p[1], p[2]) / p[1];
+        // Relative errors are only meaningful where the function is not vanishingly small
+        if (exact < 1e-6)
+            continue;
+        const double error =
+            std::abs(interpolator.interpolate(PartonFlavor::g, p[0], p[1], p[2]) / exact - 1);
+        result.maxError = std::max(result.maxError, error);
+        result.meanError += error;
+        counted++;
+    }
+    result.meanError /= static_cast<double>(std::max<size_t>(counted, 1));
+    // Keeps the timed loop from being optimized away
+    if (sum < 0)
+        std::printf("%g\n", sum);
+    return result;
+}
+} // namespace
+
+int main()
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<std::array<double, 3>> points(200000);
+    for (auto &p : points)
+        p = {X_MIN * std::pow(X_MAX / X_MIN, uniform(generator)),
+             KT2_MIN * std::pow(KT2_MAX / KT2_MIN, uniform(generator)),
+             MU2_MIN * std::pow(MU2_MAX / MU2_MIN, uniform(generator))};
+
+    std::printf("%6s | %-34s | %-34s\n", "knots", "trilinear: max / mean error, ns",
+                "tricubic: max / mean error, ns");
+    for (size_t nKnots : {8, 12, 16, 24, 32, 48, 64})
+    {
+        const AnalyticTMDReader reader(nKnots);
+        const Result linear = measure<TTrilinearInterpolator<AnalyticTMDReader>>(reader, points);
+        const Result cubic = measure<TTricubicInterpolator<AnalyticTMDReader>>(reader, points);
+        std::printf("%6zu | %10.2e %10.2e %10.1f   | %10.2e %10.2e %10.1f\n", nKnots,
+                    linear.maxError, linear.meanError, linear.nsPerCall, cubic.maxError,
+                    cubic.meanError, cubic.nsPerCall);
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+"""Compares NumPy array calls of the pdfxtmd bindings with a Python loop over the scalar ones.
+
+Usage: python vectorized_benchmark.py [cPDF set] [TMD set] [number of points] [threads]
+"""
+import sys
+import time
+
+import numpy as np
+import pdfxtmd
+
+CPDF_SET = sys.argv[1] if len(sys.argv) > 1 else "CT18NLO"
+TMD_SET = sys.argv[2] if len(sys.argv) > 2 else "PB-LO-HERAI+II-2020-set2"
+N_POINTS = int(sys.argv[3]) if len(sys.argv) > 3 else 100000
+N_THREADS = int(sys.argv[4]) if len(sys.argv) > 4 else 0
+
+
+def timed(function):
+    start = time.perf_counter()
+    result = function()
+    return result, time.perf_counter() - start
+
+
+def report(name, n_points, loop, vectorized):
+    loop_values, loop_time = timed(loop)
+    values, vectorized_time = timed(vectorized)
+    max_difference = np.max(np.abs(np.asarray(loop_values) - values))
+    print(f"{name:<28} loop {loop_time * 1e9 / n_points:9.1f} ns/point   "
+          f"array {vectorized_time * 1e9 / n_points:9.1f} ns/point   "
+          f"speedup {loop_time / vectorized_time:6.1f}x   max |diff| {max_difference:.1e}")
+
+
+rng = np.random.default_rng(42)
+x = 10 ** rng.uniform(-4, -0.5, N_POINTS)
+kt2 = 10 ** rng.uniform(-1, 2, N_POINTS)
+mu2 = 10 ** rng.uniform(1, 4, N_POINTS)
+g = pdfxtmd.PartonFlavor.g
+
+cpdf_set = pdfxtmd.CPDFSet(CPDF_SET)
+cpdf = cpdf_set[0]
+report("cPDF, one flavor", N_POINTS,
+       lambda: [cpdf.pdf(g, xi, mi) for xi, mi in zip(x, mu2)],
+       lambda: cpdf.pdf(g, x, mu2))
+
+
+def cpdf_all_flavors_loop():
+    values = []
+    for xi, mi in zip(x, mu2):
+        output = []
+        cpdf.pdf(xi, mi, output)
+        values.append(output)
+    return values
+
+
+report("cPDF, all flavors", N_POINTS, cpdf_all_flavors_loop, lambda: cpdf.pdf(x, mu2))
+report("alphasQ2", N_POINTS,
+       lambda: [cpdf_set.alphasQ2(mi) for mi in mu2],
+       lambda: cpdf_set.alphasQ2(mu2))
+
+tmd_set = pdfxtmd.TMDSet(TMD_SET)
+tmd = tmd_set[0]
+report("TMD, one flavor", N_POINTS,
+       lambda: [tmd.tmd(g, xi, ki, mi) for xi, ki, mi in zip(x, kt2, mu2)],
+       lambda: tmd.tmd(g, x, kt2, mu2))
+
+
+def tmd_all_flavors_loop():
+    values = []
+    for xi, ki, mi in zip(x, kt2, mu2):
+        output = []
+        tmd.tmd(xi, ki, mi, output)
+        values.append(output)
+    return values
+
+
+report("TMD, all flavors", N_POINTS, tmd_all_flavors_loop, lambda: tmd.tmd(x, kt2, mu2))
+
+# Uncertainties evaluate every member of the set, so they use fewer points
+n = min(N_POINTS, 1000)
+report("TMD uncertainty", n,
+       lambda: [tmd_set.Uncertainty(g, xi, ki, mi).errsymm
+                for xi, ki, mi in zip(x[:n], kt2[:n], mu2[:n])],
+       lambda: tmd_set.Uncertainty(g, x[:n], kt2[:n], mu2[:n])["errsymm"])
+
+# The same calls split over a pool of C++ threads
+report(f"TMD, all flavors, {N_THREADS or 'all'} threads", N_POINTS, lambda: tmd.tmd(x, kt2, mu2),
+       lambda: tmd.tmd(x, kt2, mu2, n_threads=N_THREADS))
+report(f"TMD uncertainty, {N_THREADS or 'all'} threads", n,
+       lambda: tmd_set.Uncertainty(g, x[:n], kt2[:n], mu2[:n])["errsymm"],
+       lambda: tmd_set.Uncertainty(g, x[:n], kt2[:n], mu2[:n], n_threads=N_THREADS)["errsymm"])
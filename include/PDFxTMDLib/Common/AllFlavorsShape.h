@@ -54,6 +54,8 @@ struct DefaultAllFlavorShape
     void initializeBicubicCoeficient();
     void finalizeXP2();
     void initPidLookup();
+    /// Approximate heap memory held by the grid, in bytes
+    size_t memoryUsage() const;
     std::unordered_map<PartonFlavor, std::vector<double>> grids;
     double getGridFromMap(PartonFlavor flavor, int ix, int iq2) const;
     // Removed grids map; use grids_flat only for speed
@@ -75,7 +77,7 @@ struct DefaultAllFlavorShape
         else if (id == 21)
             return _lookup[0 + 6];
         else if (id == 22)
-            return _lookup[13];
+            return _lookup[13 + 6];
         else
             return findPidInPids(id, _pids);
     }
@@ -88,12 +90,25 @@ struct DefaultAllFlavorShape
     std::array<int, 29> _lookup; // Fixed-size lookup for -6 to 22
 };
 
+/// TMD grid; the values of all flavors are stored in grids_flat as [x][kt2][mu2][flavor], with the
+/// flavor index given by get_pid.
 struct DefaultAllFlavorTMDShape : DefaultAllFlavorShape
 {
     DefaultAllFlavorTMDShape() = default;
     alignas(64) std::vector<double> log_kt2_vec;
     alignas(64) std::vector<double> kt2_vec;
+    size_t n_kt2s = 0;
+    size_t stride_ikt2 = 0;
+    /// Computes the log knots from x_vec, kt2_vec and mu2_vec, then calls initTMDLayout
     void finalizeXKt2P2();
+    /// Sets the knot counts, strides and flavor lookup from the log knots and _pids
+    void initTMDLayout();
+    size_t memoryUsage() const;
+
+    inline double tmdxf(size_t ix, size_t ikt2, size_t iq2, int flavorId) const
+    {
+        return grids_flat[ix * stride_ix + ikt2 * stride_ikt2 + iq2 * stride_iq2 + flavorId];
+    }
 };
 
 } // namespace PDFxTMD
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
 #include <optional>
 #include <sstream> 
 #include <string>
@@ -43,6 +44,16 @@ class ConfigWrapper
 
     bool loadFromString(const std::string &data_string, Format format);
 
+    /**
+     * @brief Returns the parsed YAML file @p filepath, shared by all callers in the process.
+     *
+     * The file is parsed again only when its modification time or size changes. Returns nullptr
+     * if the file cannot be loaded; failures are not cached.
+     */
+    static std::shared_ptr<const ConfigWrapper> loadCached(const std::filesystem::path &filepath);
+    /// Forgets all files parsed by loadCached.
+    static void clearCache();
+
 template <typename T>
 std::pair<std::optional<T>, ErrorType> get(const std::string &key) const {
     if (data.format == Format::YAML) {
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace PDFxTMD
+{
+/**
+ * @class GridCache
+ * @brief Process-wide cache of parsed grid files, shared between readers.
+ *
+ * Readers load their grid through `GetOrLoad`, keyed on the reader kind, the resolved file path
+ * and the file's modification time and size. A member that is already loaded, for example by
+ * another PDFSet, is handed out again without touching the file; a modified file is parsed anew.
+ * Concurrent requests for the same file wait for a single parse.
+ *
+ * Grids are immutable once loaded and shared through `std::shared_ptr`. When the grids kept by
+ * the cache exceed the memory limit, the least recently used grids that nobody else references
+ * are dropped. The limit defaults to 1024 MB and can be set with the environment variable
+ * `PDFXTMD_GRID_CACHE_MB` or `SetMemoryLimit`; a limit of zero only shares grids while they are
+ * in use.
+ */
+class GridCache
+{
+  public:
+    /// @brief Returns the process-wide cache.
+    static GridCache &Global();
+
+    /**
+     * @brief Returns the grid of `path` for reader `kind`, calling `load` if it is not cached.
+     * @param kind Identifies the reader and so the grid type; one kind always maps to one Grid.
+     * @param path Resolved path of the grid file.
+     * @param load Callable returning the parsed grid as `std::shared_ptr<Grid>`. Its exceptions
+     * are rethrown to every caller waiting for this grid, and nothing is cached.
+     */
+    template <typename Grid, typename Loader>
+    std::shared_ptr<const Grid> GetOrLoad(const std::string &kind, const std::string &path,
+                                          Loader &&load)
+    {
+        return std::static_pointer_cast<const Grid>(GetOrLoadImpl(kind, path, [&]() {
+            std::shared_ptr<const Grid> grid = load();
+            return std::make_pair(std::shared_ptr<const void>(grid), grid->memoryUsage());
+        }));
+    }
+
+    /// @brief Sets the memory limit in bytes and drops unused grids above it.
+    void SetMemoryLimit(size_t bytes);
+    /// @brief Memory limit in bytes.
+    size_t MemoryLimit() const;
+    /// @brief Memory held by the cached grids in bytes, including grids in use.
+    size_t MemoryUsage() const;
+    /// @brief Forgets all grids; grids in use stay valid for their owners.
+    void Clear();
+
+  private:
+    using Loaded = std::pair<std::shared_ptr<const void>, size_t>;
+    using Key = std::tuple<std::string, std::string, int64_t, uintmax_t>;
+    struct Entry
+    {
+        std::shared_future<std::shared_ptr<const void>> grid;
+        size_t bytes = 0;
+        bool ready = false;
+        uint64_t lastUse = 0;
+    };
+
+    GridCache();
+    std::shared_ptr<const void> GetOrLoadImpl(const std::string &kind, const std::string &path,
+                                              const std::function<Loaded()> &load);
+    void EvictUnused();
+
+    mutable std::mutex m_mtx;
+    std::map<Key, Entry> m_entries;
+    size_t m_bytes = 0;
+    size_t m_limit = 0;
+    uint64_t m_tick = 0;
+};
+} // namespace PDFxTMD
@@ -0,0 +1,287 @@
+#pragma once
+#include "PDFxTMDLib/Common/Logger.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(PDFXTMD_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#elif defined(PDFXTMD_INSTRUMENTATION) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/// One call in this many is timed on each thread; the others are only counted
+#ifndef PDFXTMD_INSTRUMENTATION_SAMPLING_PERIOD
+#define PDFXTMD_INSTRUMENTATION_SAMPLING_PERIOD 64
+#endif
+
+namespace PDFxTMD
+{
+/// Timed paths of a PDF member
+enum class InstrumentedPath
+{
+    Interpolate, ///< Points inside the grid
+    Extrapolate, ///< Points outside the grid, handed to the extrapolator
+    Count
+};
+
+/// Branches counted inside the interpolators and extrapolators
+enum class InstrumentationCounter
+{
+    InterpolateFallback, ///< Bilinear fallback of CLHAPDFBicubicInterpolator, per flavor
+    ContinuationSmallX,  ///< Regions of CContinuationExtrapolator
+    ContinuationLargeQ2,
+    ContinuationSmallXLargeQ2,
+    ContinuationSmallQ2SmallX,
+    ContinuationSmallQ2,
+    Count
+};
+
+/// Counts and sampled timings of one path
+struct PathCounters
+{
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> sampledCalls{0};
+    std::atomic<uint64_t> sampledTicks{0};
+};
+
+/// Live counters of one member of a set, shared by every copy and reload of the member
+struct PDFCounters
+{
+    PDFCounters(std::string set_, int member_) : set(std::move(set_)), member(member_)
+    {
+    }
+    const std::string set;
+    const int member;
+    std::array<PathCounters, static_cast<size_t>(InstrumentedPath::Count)> paths;
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(InstrumentationCounter::Count)> counters{};
+    std::atomic<uint64_t> loads{0};
+    std::atomic<uint64_t> loadNanoseconds{0};
+    std::atomic<uint64_t> gridBytes{0};
+};
+
+/// Copy of PathCounters at one moment
+struct PathStatistics
+{
+    uint64_t calls = 0;
+    uint64_t sampledCalls = 0;
+    uint64_t sampledTicks = 0;
+
+    /// Mean ticks per call over the sampled calls, 0 before the first sample
+    double TicksPerCall() const
+    {
+        return sampledCalls ? static_cast<double>(sampledTicks) / sampledCalls : 0.0;
+    }
+};
+
+/// Copy of PDFCounters at one moment
+struct PDFStatistics
+{
+    std::string set;
+    int member = 0;
+    std::array<PathStatistics, static_cast<size_t>(InstrumentedPath::Count)> paths;
+    std::array<uint64_t, static_cast<size_t>(InstrumentationCounter::Count)> counters{};
+    uint64_t loads = 0;
+    uint64_t loadNanoseconds = 0;
+    /// Grid and interpolation tables of the member; members sharing a grid through GridCache
+    /// each report it
+    uint64_t gridBytes = 0;
+
+    const PathStatistics &path(InstrumentedPath p) const
+    {
+        return paths[static_cast<size_t>(p)];
+    }
+    uint64_t counter(InstrumentationCounter c) const
+    {
+        return counters[static_cast<size_t>(c)];
+    }
+};
+
+struct InstrumentationStatistics
+{
+    /// Name of the tick unit of the sampled timings, "cycles" or "ns"
+    std::string tickUnit;
+    uint64_t samplingPeriod = PDFXTMD_INSTRUMENTATION_SAMPLING_PERIOD;
+    /// IQCDCoupling::AlphaQCDMu2, per scale
+    PathStatistics alphas;
+    /// Combination of member values by PDFSet::Uncertainty, per point
+    PathStatistics uncertainty;
+    std::vector<PDFStatistics> pdfs;
+};
+
+/**
+ * @class Instrumentation
+ * @brief Counters and sampled timings of the hot paths, compiled in with the CMake option
+ * ENABLE_INSTRUMENTATION (which defines PDFXTMD_INSTRUMENTATION).
+ *
+ * Without the option the PDFXTMD_INSTRUMENT and PDFXTMD_COUNT macros expand to nothing and no
+ * PDF registers counters, so Snapshot() is empty. With it, every member counts its in-grid and
+ * out-of-range calls, the branches taken by the extrapolators and interpolators, its load time
+ * and its grid memory, and times one call in PDFXTMD_INSTRUMENTATION_SAMPLING_PERIOD with the
+ * cycle counter (steady_clock nanoseconds on CPUs without one).
+ *
+ * At exit the statistics are written as JSON to the file named by the environment variable
+ * `PDFXTMD_INSTRUMENTATION_FILE`, or else to PDFxTMDLOG when the Logger is enabled.
+ */
+class Instrumentation
+{
+  public:
+    static constexpr bool Enabled()
+    {
+#ifdef PDFXTMD_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief Counters of member @p member of @p set, created on first use.
+    static std::shared_ptr<PDFCounters> Counters(const std::string &set, int member);
+    static PathCounters &AlphaS();
+    static PathCounters &Uncertainty();
+
+    /// @brief Copies all counters.
+    static InstrumentationStatistics Snapshot();
+    /// @brief Writes Snapshot() as a JSON object.
+    static void WriteJSON(std::ostream &os);
+    /// @brief Zeroes all counters; members loaded before keep reporting into theirs.
+    static void Reset();
+
+    /// @brief Counters of the member evaluated by this thread, or nullptr outside evaluations.
+    static PDFCounters *&Current();
+    /// @brief Whether this thread times its current call.
+    static bool Sample();
+
+    static uint64_t Ticks()
+    {
+#if defined(PDFXTMD_INSTRUMENTATION) &&                                                          \
+    (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+#endif
+    }
+
+    static void Count(InstrumentationCounter counter)
+    {
+        if (PDFCounters *pdf = Current())
+            pdf->counters[static_cast<size_t>(counter)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Counts @p n calls of a path, times them if sampled and marks the member as current
+    class PathScope
+    {
+      public:
+        PathScope(PathCounters &path, uint64_t n) : m_path(path), m_n(n)
+        {
+            start();
+        }
+        PathScope(PDFCounters &pdf, InstrumentedPath path, uint64_t n)
+            : m_path(pdf.paths[static_cast<size_t>(path)]), m_n(n), m_previous(Current())
+        {
+            Current() = &pdf;
+            m_restore = true;
+            start();
+        }
+        ~PathScope()
+        {
+            if (m_sampled)
+            {
+                m_path.sampledTicks.fetch_add(Ticks() - m_start, std::memory_order_relaxed);
+                m_path.sampledCalls.fetch_add(m_n, std::memory_order_relaxed);
+            }
+            if (m_restore)
+                Current() = m_previous;
+        }
+        PathScope(const PathScope &) = delete;
+        PathScope &operator=(const PathScope &) = delete;
+
+      private:
+        void start()
+        {
+            m_path.calls.fetch_add(m_n, std::memory_order_relaxed);
+            m_sampled = Sample();
+            if (m_sampled)
+                m_start = Ticks();
+        }
+        PathCounters &m_path;
+        uint64_t m_n;
+        PDFCounters *m_previous = nullptr;
+        bool m_restore = false;
+        bool m_sampled = false;
+        uint64_t m_start = 0;
+    };
+
+    /// Measures the load of a member and records it with its grid memory
+    class LoadTimer
+    {
+      public:
+        explicit LoadTimer(PDFCounters &pdf)
+            : m_pdf(pdf), m_start(std::chrono::steady_clock::now())
+        {
+        }
+        void Finish(size_t gridBytes)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_pdf.loads.fetch_add(1, std::memory_order_relaxed);
+            m_pdf.loadNanoseconds.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                std::memory_order_relaxed);
+            m_pdf.gridBytes.store(gridBytes, std::memory_order_relaxed);
+        }
+
+      private:
+        PDFCounters &m_pdf;
+        std::chrono::steady_clock::time_point m_start;
+    };
+};
+
+/// @brief Detects grids reporting their memory through `memoryUsage()`
+template <typename T, typename = void> struct HasMemoryUsage : std::false_type
+{
+};
+template <typename T>
+struct HasMemoryUsage<T, std::void_t<decltype(std::declval<const T &>().memoryUsage())>>
+    : std::true_type
+{
+};
+/// @brief Detects interpolators exposing precomputed coefficients through `getCoefficients()`
+template <typename T, typename = void> struct HasCoefficients : std::false_type
+{
+};
+template <typename T>
+struct HasCoefficients<T, std::void_t<decltype(std::declval<const T &>().getCoefficients())>>
+    : std::true_type
+{
+};
+} // namespace PDFxTMD
+
+#define PDFXTMD_CONCAT_IMPL(a, b) a##b
+#define PDFXTMD_CONCAT(a, b) PDFXTMD_CONCAT_IMPL(a, b)
+#ifdef PDFXTMD_INSTRUMENTATION
+/// Counts and samples the rest of the scope as @p n calls of @p path of the member @p counters
+#define PDFXTMD_INSTRUMENT_N(counters, path, n)                                                  \
+    PDFxTMD::Instrumentation::PathScope PDFXTMD_CONCAT(pdfxtmdPathScope, __LINE__)(              \
+        *(counters), PDFxTMD::InstrumentedPath::path, (n))
+#define PDFXTMD_INSTRUMENT(counters, path) PDFXTMD_INSTRUMENT_N(counters, path, 1)
+/// Counts and samples the rest of the scope as @p n calls of the global path @p path
+#define PDFXTMD_INSTRUMENT_GLOBAL(path, n)                                                       \
+    PDFxTMD::Instrumentation::PathScope PDFXTMD_CONCAT(pdfxtmdPathScope, __LINE__)(              \
+        PDFxTMD::Instrumentation::path(), (n))
+/// Counts @p counter, an InstrumentationCounter, for the member being evaluated
+#define PDFXTMD_COUNT(counter) PDFxTMD::Instrumentation::Count(counter)
+#else
+#define PDFXTMD_INSTRUMENT_N(counters, path, n)
+#define PDFXTMD_INSTRUMENT(counters, path)
+#define PDFXTMD_INSTRUMENT_GLOBAL(path, n)
+#define PDFXTMD_COUNT(counter)
+#endif
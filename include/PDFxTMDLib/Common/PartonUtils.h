@@ -87,7 +87,13 @@ std::vector<std::string> splitPaths(const std::string &paths);
 bool hasWriteAccess(const std::string &path);
 double _extrapolateLinear(double x, double xl, double xh, double yl, double yh);
 std::string StandardPDFNaming(const std::string &pdfName, int set);
+/// Search paths for PDF sets. They are resolved again only when the working directory or
+/// config.yaml changes.
 std::vector<std::string> GetPDFxTMDPathsAsVector();
+/// Forgets the resolved search paths and the set and member files found in them, e.g. after
+/// adding a set to a search path that comes before the one it was found in. Files that no longer
+/// exist are searched for again without it.
+void ClearPathCache();
 std::vector<std::string> GetPDFxTMDPathsFromYaml();
 bool AddPathToEnvironment(const std::string &newPath);
 std::vector<std::string> split(const std::string &str, char delimiter);
@@ -0,0 +1,85 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PDFxTMD
+{
+/**
+ * @class ThreadPool
+ * @brief A small fixed-size pool of worker threads used to split index ranges into chunks.
+ *
+ * The library owns a single process-wide pool which is disabled (zero workers) by default, so
+ * nothing changes unless the user opts in through `ThreadPool::SetGlobalThreads`. Work is handed
+ * out as contiguous `[begin, end)` chunks of an index range; the calling thread takes part in the
+ * evaluation, so results written by index are deterministic regardless of scheduling.
+ *
+ * Nested calls (a `ParallelFor` issued from inside a chunk) run serially on the current thread,
+ * which keeps the total number of busy threads bounded by the pool size plus the callers.
+ */
+class ThreadPool
+{
+  public:
+    /// @brief Callable invoked for each `[begin, end)` chunk.
+    using RangeFunction = std::function<void(size_t, size_t)>;
+
+    /**
+     * @brief Creates a pool with `nThreads` workers. Zero workers means serial evaluation.
+     * @param nThreads Number of worker threads.
+     */
+    explicit ThreadPool(size_t nThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// @brief Number of worker threads owned by the pool.
+    size_t size() const
+    {
+        return m_workers.size();
+    }
+
+    /**
+     * @brief Evaluates `fn(begin, end)` over `[0, n)` split into chunks of at least `grain`
+     * indices.
+     * @param n Size of the index range.
+     * @param grain Minimum number of indices per chunk.
+     * @param fn Callable invoked once per chunk. Exceptions are rethrown in the calling thread.
+     * @param maxThreads Upper bound on the total number of threads (caller included) taking part
+     * in this call; zero means no bound other than the pool size.
+     */
+    void ParallelFor(size_t n, size_t grain, const RangeFunction &fn, size_t maxThreads = 0);
+
+    /// @brief Returns true if the current thread is executing a chunk of a `ParallelFor`.
+    static bool InParallelRegion();
+
+    /// @brief Returns the process-wide pool. It has zero workers unless configured.
+    static std::shared_ptr<ThreadPool> Global();
+
+    /// @brief Number of workers of the process-wide pool, read without locking or touching the
+    /// pool; callers check it for zero to skip the pool altogether.
+    static size_t GlobalThreads();
+
+    /**
+     * @brief Resizes the process-wide pool. Calls already running on the previous pool finish on
+     * it; new calls use the new one.
+     * @param nThreads Number of worker threads, zero disables parallel evaluation.
+     * @throws InvalidInputError if called from inside a chunk of a `ParallelFor`.
+     */
+    static void SetGlobalThreads(size_t nThreads);
+
+  private:
+    void WorkerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    bool m_stop = false;
+};
+} // namespace PDFxTMD
@@ -0,0 +1,45 @@
+#pragma once
+#include <PDFxTMDLib/Common/ConfigWrapper.h>
+#include <PDFxTMDLib/Common/PartonUtils.h>
+#include <PDFxTMDLib/Common/YamlMetaInfo/YamlCouplingInfo.h>
+#include <PDFxTMDLib/Common/YamlMetaInfo/YamlErrorInfo.h>
+#include <PDFxTMDLib/Common/YamlMetaInfo/YamlImpelemntationInfo.h>
+#include <PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace PDFxTMD
+{
+/**
+ * @brief Everything the library reads from the .info file of a PDF set, from a single parse.
+ *
+ * The sections keep the results of the individual Yaml*InfoReader functions, so callers handle
+ * missing or invalid entries as before. It is shared by the factories, GenericPDF, the readers and
+ * PDFSet, so the members of a set do not parse their info file again.
+ */
+struct SetMetadata
+{
+    std::string pdfSetName;
+    std::string infoPath;
+    /// The parsed info file, for keys without a dedicated section
+    std::shared_ptr<const ConfigWrapper> config;
+    std::pair<std::optional<YamlStandardTMDInfo>, ErrorType> standardInfo;
+    std::pair<std::optional<YamlErrorInfo>, ErrorType> errorInfo;
+    std::pair<std::optional<YamlImpelemntationInfo>, ErrorType> implementationInfo;
+    std::pair<std::optional<YamlCouplingInfo>, ErrorType> couplingInfo;
+    /// Set if the coupling entries are inconsistent; rethrown when a coupling is created, so the
+    /// PDFs of such a set can still be used.
+    std::exception_ptr couplingException;
+};
+
+/**
+ * @brief Returns the metadata of the PDF set @p pdfSetName.
+ *
+ * The result is shared by all callers until the info file changes on disk. The error is
+ * FILE_NOT_FOUND if the info file cannot be found or parsed.
+ */
+std::pair<std::shared_ptr<const SetMetadata>, ErrorType> SetMetadataReader(
+    const std::string &pdfSetName);
+} // namespace PDFxTMD
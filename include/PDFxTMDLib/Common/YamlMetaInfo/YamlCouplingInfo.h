@@ -6,6 +6,7 @@
 
 namespace PDFxTMD
 {
+class ConfigWrapper;
 
 enum class AlphasType
 {
@@ -43,6 +44,8 @@ struct YamlCouplingInfo
 // Calculate the number of active quark flavours at energy scale Q2
 std::pair<std::optional<YamlCouplingInfo>, ErrorType> YamlCouplingInfoReader(
     const std::string &yamlInfoPath);
+std::pair<std::optional<YamlCouplingInfo>, ErrorType> YamlCouplingInfoReader(
+    const ConfigWrapper &config);
 int numFlavorsQ2(double q2, const YamlCouplingInfo &couplingInfo, int nfMin = -1, int nfMax = -1);
 // Calculate a beta function given the number of active flavours
 double beta(OrderQCD qcdOrder, int nf);
@@ -5,6 +5,7 @@
 
 namespace PDFxTMD
 {
+class ConfigWrapper;
 struct YamlErrorInfo
 {
     double ErrorConfLevel;
@@ -14,4 +15,6 @@ struct YamlErrorInfo
 };
 std::pair<std::optional<YamlErrorInfo>, ErrorType> YamlErrorInfoReader(
     const std::string &yamlInfoPath);
+std::pair<std::optional<YamlErrorInfo>, ErrorType> YamlErrorInfoReader(
+    const ConfigWrapper &config);
 } // namespace PDFxTMD
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 namespace PDFxTMD
 {
+class ConfigWrapper;
 struct YamlImpelemntationInfo
 {
     std::string reader = "";
@@ -14,4 +15,6 @@ struct YamlImpelemntationInfo
 
 std::pair<std::optional<YamlImpelemntationInfo>, ErrorType> YamlImpelemntationInfoReader(
     const std::string &yamlInfoPath);
+std::pair<std::optional<YamlImpelemntationInfo>, ErrorType> YamlImpelemntationInfoReader(
+    const ConfigWrapper &config);
 } // namespace PDFxTMD
\ No newline at end of file
@@ -31,4 +31,6 @@ struct YamlStandardTMDInfo : YamlStandardPDFInfo
 
 std::pair<std::optional<YamlStandardTMDInfo>, ErrorType> YamlStandardPDFInfoReader(
     const std::string &yamlInfoPath);
+std::pair<std::optional<YamlStandardTMDInfo>, ErrorType> YamlStandardPDFInfoReader(
+    const ConfigWrapper &config);
 } // namespace PDFxTMD
@@ -0,0 +1,132 @@
+#pragma once
+#include "PDFxTMDLib/Common/Exception.h"
+#include "PDFxTMDLib/GenericPDF.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CContinuationExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CErrExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CNearestPointExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/TMD/TErrExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/TMD/TZeroExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/Collinear/CLHAPDFBicubicInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/Collinear/CLHAPDFBilinearInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TTricubicInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TTrilinearInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TTrilinearTMDLibInterpolator.h"
+#include "PDFxTMDLib/Implementation/Reader/Collinear/CDefaultLHAPDFFileReader.h"
+#include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultAllFlavorReader.h"
+#include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultLHAPDF_TMDReader.h"
+#include "PDFxTMDLib/Interface/ICPDF.h"
+#include "PDFxTMDLib/Interface/ITMD.h"
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace PDFxTMD
+{
+/**
+ * @brief Compile-time access to the GenericPDF behind an ICPDF or ITMD.
+ *
+ * ICPDF and ITMD hide their GenericPDF<Tag, Reader, Interpolator, Extrapolator> behind function
+ * pointers, so every evaluation is an indirect call that the compiler cannot inline. Code that
+ * evaluates many points can instead resolve the concrete type once, with withConcrete, and run
+ * its whole loop on it:
+ *
+ * @code
+ * ICPDF pdf = GenericCPDFFactory().mkCPDF("CT18NLO", 0);
+ * double sum = withConcrete(pdf, [&](const auto &concrete) {
+ *     double s = 0;
+ *     for (size_t i = 0; i < xs.size(); ++i)
+ *         s += concrete.pdf(PartonFlavor::g, xs[i], mu2s[i]);
+ *     return s;
+ * });
+ * @endcode
+ *
+ * When the configuration is known in advance, GenericCPDFFactory::mkTypedCPDF and
+ * GenericTMDFactory::mkTypedTMD return the concrete type directly.
+ */
+
+/// Collinear GenericPDF instantiations that GenericCPDFFactory can create
+using FactoryCPDFTypes = std::tuple<
+    GenericPDF<CollinearPDFTag, CDefaultLHAPDFFileReader,
+               CLHAPDFBicubicInterpolator<CDefaultLHAPDFFileReader>,
+               CContinuationExtrapolator<CLHAPDFBicubicInterpolator<CDefaultLHAPDFFileReader>>>,
+    GenericPDF<CollinearPDFTag, CDefaultLHAPDFFileReader,
+               CLHAPDFBicubicInterpolator<CDefaultLHAPDFFileReader>, CErrExtrapolator>,
+    GenericPDF<CollinearPDFTag, CDefaultLHAPDFFileReader,
+               CLHAPDFBicubicInterpolator<CDefaultLHAPDFFileReader>,
+               CNearestPointExtrapolator<CLHAPDFBicubicInterpolator<CDefaultLHAPDFFileReader>>>,
+    GenericPDF<CollinearPDFTag, CDefaultLHAPDFFileReader,
+               CLHAPDFBilinearInterpolator<CDefaultLHAPDFFileReader>,
+               CContinuationExtrapolator<CLHAPDFBilinearInterpolator<CDefaultLHAPDFFileReader>>>,
+    GenericPDF<CollinearPDFTag, CDefaultLHAPDFFileReader,
+               CLHAPDFBilinearInterpolator<CDefaultLHAPDFFileReader>, CErrExtrapolator>,
+    GenericPDF<CollinearPDFTag, CDefaultLHAPDFFileReader,
+               CLHAPDFBilinearInterpolator<CDefaultLHAPDFFileReader>,
+               CNearestPointExtrapolator<CLHAPDFBilinearInterpolator<CDefaultLHAPDFFileReader>>>>;
+
+/// TMD GenericPDF instantiations that GenericTMDFactory can create
+using FactoryTMDTypes = std::tuple<
+    GenericPDF<TMDPDFTag, TDefaultLHAPDF_TMDReader,
+               TTrilinearInterpolator<TDefaultLHAPDF_TMDReader>, TZeroExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultLHAPDF_TMDReader,
+               TTrilinearInterpolator<TDefaultLHAPDF_TMDReader>, TErrExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultAllFlavorReader,
+               TTrilinearTMDLibInterpolator<TDefaultAllFlavorReader>, TZeroExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultAllFlavorReader,
+               TTrilinearTMDLibInterpolator<TDefaultAllFlavorReader>, TErrExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultLHAPDF_TMDReader,
+               TTricubicInterpolator<TDefaultLHAPDF_TMDReader>, TZeroExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultLHAPDF_TMDReader,
+               TTricubicInterpolator<TDefaultLHAPDF_TMDReader>, TErrExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultAllFlavorReader,
+               TTricubicInterpolator<TDefaultAllFlavorReader>, TZeroExtrapolator>,
+    GenericPDF<TMDPDFTag, TDefaultAllFlavorReader,
+               TTricubicInterpolator<TDefaultAllFlavorReader>, TErrExtrapolator>>;
+
+/// Candidate types withConcrete tries by default for an interface
+template <typename Interface> struct FactoryTypes;
+template <> struct FactoryTypes<ICPDF>
+{
+    using type = FactoryCPDFTypes;
+};
+template <> struct FactoryTypes<ITMD>
+{
+    using type = FactoryTMDTypes;
+};
+
+namespace detail
+{
+template <typename Interface, typename F, typename Candidate, typename... Rest>
+decltype(auto) dispatchConcrete(Interface &pdf, F &f, std::tuple<Candidate, Rest...> *)
+{
+    using Concrete = std::conditional_t<std::is_const_v<Interface>, const Candidate, Candidate>;
+    if (Concrete *concrete = pdf.template target<Candidate>())
+        return f(*concrete);
+    if constexpr (sizeof...(Rest) > 0)
+        return dispatchConcrete(pdf, f, static_cast<std::tuple<Rest...> *>(nullptr));
+    else
+        throw NotSupportError("withConcrete: the PDF is not one of the candidate types (" +
+                              std::string(pdf.targetType().name()) + ")");
+}
+} // namespace detail
+
+/**
+ * @brief Runs @p f on the concrete GenericPDF wrapped by @p pdf and returns its result.
+ *
+ * The wrapped type is looked up once; inside @p f every evaluation is a direct call. @p f is
+ * instantiated for every candidate type, typically as a generic lambda, and has to return the same
+ * type for all of them.
+ *
+ * @tparam Candidates std::tuple of the types to try, by default every type the factory creates.
+ * Pass your own list for GenericPDF instantiations wrapped by hand.
+ * @param pdf An ICPDF or ITMD, const or not; @p f receives a matching (const) reference.
+ * @throws NotSupportError if the wrapped type is not among the candidates
+ */
+template <typename Candidates = void, typename Interface, typename F>
+decltype(auto) withConcrete(Interface &pdf, F &&f)
+{
+    using Types = std::conditional_t<std::is_void_v<Candidates>,
+                                     typename FactoryTypes<std::remove_const_t<Interface>>::type,
+                                     Candidates>;
+    return detail::dispatchConcrete(pdf, f, static_cast<Types *>(nullptr));
+}
+} // namespace PDFxTMD
@@ -1,4 +1,5 @@
 #pragma once
+#include "PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h"
 #include "PDFxTMDLib/GenericPDF.h"
 #include "PDFxTMDLib/Interface/ICPDF.h"
 #include "PDFxTMDLib/Interface/IQCDCoupling.h"
@@ -24,6 +25,13 @@ class CouplingFactory
      * @return IQCDCoupling The newly created IQCDCoupling object
      */
     IQCDCoupling mkCoupling(const std::string &pdfSetName);
+    /**
+     * @brief Creates a new IQCDCoupling object from already loaded set metadata
+     *
+     * @param metadata The metadata of the PDF set, see SetMetadataReader
+     * @return IQCDCoupling The newly created IQCDCoupling object
+     */
+    IQCDCoupling mkCoupling(const SetMetadata &metadata);
 
   private:
     std::string m_pdfSetName;
@@ -43,9 +51,10 @@ class CouplingFactory
  * ~/usr/local/share/PDFxTMDLib/ (on linux) are also included. Note: This class by default uses
  * CDefaultLHAPDFFileReader to read the PDF set. If you want to use a different reader, you modify
  * the yaml info file of the PDF set and adding or modify "Reader" field. For interpolation, you can
- * modify the "Interpolator" field. The default interpolator is TTrilinearInterpolator. For
- * extrapolation, you can modify the "Extrapolator" field. The default extrapolator is
- * TZeroExtrapolator
+ * modify the "Interpolator" field. The default interpolator is TTrilinearInterpolator;
+ * TTricubicInterpolator is more accurate on coarse grids. For extrapolation, you can modify the "Extrapolator" field. The default extrapolator is
+ * TZeroExtrapolator. The names are resolved through TMDRegistry (see PDFRegistry.h), where further
+ * implementations can be registered.
  */
 class GenericTMDFactory
 {
@@ -59,6 +68,35 @@ class GenericTMDFactory
      * @return ITMD The newly created ITMD object
      */
     ITMD mkTMD(const std::string &pdfSetName, int setMember);
+    /**
+     * @brief Creates a new ITMD object from already loaded set metadata, so that creating many
+     * members reads the info file once
+     *
+     * @param metadata The metadata of the PDF set, see SetMetadataReader
+     * @param setMember The member number of the PDF set
+     * @return ITMD The newly created ITMD object
+     */
+    ITMD mkTMD(const SetMetadata &metadata, int setMember);
+    /**
+     * @brief Creates the TMD as its concrete GenericPDF type, for code that knows the set's
+     * reader, interpolator and extrapolator at compile time (see FactoryTMDTypes in
+     * ConcretePDF.h).
+     *
+     * @tparam TMDApproachT The expected GenericPDF<TMDPDFTag, ...> instantiation
+     * @param pdfSetName The name of the PDF set
+     * @param setMember The member number of the PDF set
+     * @return TMDApproachT The newly created TMD object
+     * @throws NotSupportError if the set is configured for another GenericPDF type
+     */
+    template <typename TMDApproachT>
+    TMDApproachT mkTypedTMD(const std::string &pdfSetName, int setMember)
+    {
+        ITMD tmd = mkTMD(pdfSetName, setMember);
+        if (TMDApproachT *typed = tmd.target<TMDApproachT>())
+            return std::move(*typed);
+        throw NotSupportError("TMD set " + pdfSetName + " is configured for another type (" +
+                              std::string(tmd.targetType().name()) + ")");
+    }
 };
 /**
  * @brief Factory class for creating collinear PDF objects
@@ -75,9 +113,10 @@ class GenericTMDFactory
  * ~/usr/local/share/PDFxTMDLib/ (on linux) are also included. Note: This class by default uses
  * CDefaultLHAPDFFileReader to read the PDF set. If you want to use a different reader, you modify
  * the yaml info file of the PDF set and adding or modify "Reader" field. For interpolation, you can
- * modify the "Interpolator" field. The default interpolator is CLHAPDFBilinearInterpolator. For
+ * modify the "Interpolator" field. The default interpolator is CLHAPDFBicubicInterpolator. For
  * extrapolation, you can modify the "Extrapolator" field. The default extrapolator is
- * CContinuationExtrapolator
+ * CContinuationExtrapolator. The names are resolved through CPDFRegistry (see PDFRegistry.h), where
+ * further implementations can be registered.
  */
 
 class GenericCPDFFactory
@@ -92,5 +131,35 @@ class GenericCPDFFactory
      * @return ICPDF The newly created ICPDF object
      */
     ICPDF mkCPDF(const std::string &pdfSetName, int setMember);
+    /**
+     * @brief Creates a new ICPDF object from already loaded set metadata, so that creating many
+     * members reads the info file once
+     *
+     * @param metadata The metadata of the PDF set, see SetMetadataReader
+     * @param setMember The member number of the PDF set
+     * @return ICPDF The newly created ICPDF object
+     */
+    ICPDF mkCPDF(const SetMetadata &metadata, int setMember);
+    /**
+     * @brief Creates the collinear PDF as its concrete GenericPDF type, for code that knows the
+     * set's reader, interpolator and extrapolator at compile time (see FactoryCPDFTypes in
+     * ConcretePDF.h).
+     *
+     * @tparam CPDFApproachT The expected GenericPDF<CollinearPDFTag, ...> instantiation
+     * @param pdfSetName The name of the PDF set
+     * @param setMember The member number of the PDF set
+     * @return CPDFApproachT The newly created collinear PDF object
+     * @throws NotSupportError if the set is configured for another GenericPDF type
+     */
+    template <typename CPDFApproachT>
+    CPDFApproachT mkTypedCPDF(const std::string &pdfSetName, int setMember)
+    {
+        ICPDF cpdf = mkCPDF(pdfSetName, setMember);
+        if (CPDFApproachT *typed = cpdf.target<CPDFApproachT>())
+            return std::move(*typed);
+        throw NotSupportError("Collinear PDF set " + pdfSetName +
+                              " is configured for another type (" +
+                              std::string(cpdf.targetType().name()) + ")");
+    }
 };
 } // namespace PDFxTMD
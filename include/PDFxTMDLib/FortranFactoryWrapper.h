@@ -4,18 +4,83 @@
 
 extern "C"
 {
+    // The routines below taking int *status store a pdfxtmd_status code in it (0 on success)
+    // instead of letting an exception reach the caller. On failure handles come back null,
+    // numbers come back zero and last_error_message describes the error.
+
+    /// Result of the uncertainty routines, laid out as the Fortran type PDFUncertainty_t
+    struct PDFUncertaintyC
+    {
+        double central, errplus, errminus, errsymm, scale;
+        double errplus_pdf, errminus_pdf, errsymm_pdf;
+        double errplus_par, errminus_par, errsymm_par;
+    };
+
+    /// Copies the last error message of this thread into message, blank padded to length
+    void last_error_message(char *message, int length);
+
     // Wrapper for CouplingFactory
     void *create_coupling_factory();
     void delete_coupling_factory(void *factory);
     void *mk_coupling(void *factory, const char *pdfSetName);
+    void delete_coupling(void *couplingObject);
+    double alphaQCDMu2_wrapper(void *couplingObject, double mu2);
+    /// alphas[i] = alphaQCDMu2_wrapper(couplingObject, mu2[i]) for i < n
+    void alphaQCDMu2_batch_wrapper(void *couplingObject, const double *mu2, double *alphas, int n,
+                                   int *status);
 
     // Wrapper for GenericTMDFactory
     void *create_tmd_factory();
     void delete_tmd_factory(void *factory);
     void *mk_tmd(void *factory, const char *pdfSetName, int setMember);
+    void delete_tmd(void *tmd_obj);
+    double tmd_wrapper(void *tmd_obj, int flavor, double x, double kt2, double mu2);
+    /// All 13 flavors at one point, ordered as pid -6 to 6 with the gluon in the middle
+    void tmd_all_wrapper(void *tmd_obj, double x, double kt2, double mu2, double *output,
+                         int *status);
+    /// output[i] = tmd_wrapper(tmd_obj, flavor, x[i], kt2[i], mu2[i]) for i < n
+    void tmd_batch_wrapper(void *tmd_obj, int flavor, const double *x, const double *kt2,
+                           const double *mu2, double *output, int n, int *status);
+    /// All flavors at n points into output[13 * n], the 13 flavors of a point being contiguous
+    void tmd_all_batch_wrapper(void *tmd_obj, const double *x, const double *kt2,
+                               const double *mu2, double *output, int n, int *status);
 
     // Wrapper for GenericCPDFFactory
     void *create_cpdf_factory();
     void delete_cpdf_factory(void *factory);
     void *mk_cpdf(void *factory, const char *pdfSetName, int setMember);
-}
\ No newline at end of file
+    void delete_cpdf(void *cpdf_obj);
+    double cpdf_wrapper(void *cpdf_obj, int flavor, double x, double mu2);
+    /// All 13 flavors at one point, ordered as pid -6 to 6 with the gluon in the middle
+    void cpdf_all_wrapper(void *cpdf_obj, double x, double mu2, double *output, int *status);
+    /// output[i] = cpdf_wrapper(cpdf_obj, flavor, x[i], mu2[i]) for i < n
+    void cpdf_batch_wrapper(void *cpdf_obj, int flavor, const double *x, const double *mu2,
+                            double *output, int n, int *status);
+    /// All flavors at n points into output[13 * n], the 13 flavors of a point being contiguous
+    void cpdf_all_batch_wrapper(void *cpdf_obj, const double *x, const double *mu2,
+                                double *output, int n, int *status);
+
+    // Wrapper for PDFSet<TMDPDFTag>. Members returned by tmd_set_member belong to the set and are
+    // evaluated with the tmd_*wrapper routines. A negative cl selects the set's native CL.
+    void *create_tmd_set(const char *pdfSetName, int *status);
+    void delete_tmd_set(void *set);
+    int tmd_set_size(void *set, int *status);
+    void *tmd_set_member(void *set, int member, int *status);
+    double tmd_set_alphasQ2(void *set, double mu2, int *status);
+    void tmd_set_uncertainty(void *set, int flavor, double x, double kt2, double mu2, double cl,
+                             PDFUncertaintyC *result, int *status);
+    void tmd_set_uncertainty_batch(void *set, int flavor, const double *x, const double *kt2,
+                                   const double *mu2, int n, double cl, PDFUncertaintyC *result,
+                                   int *status);
+
+    // Wrapper for PDFSet<CollinearPDFTag>
+    void *create_cpdf_set(const char *pdfSetName, int *status);
+    void delete_cpdf_set(void *set);
+    int cpdf_set_size(void *set, int *status);
+    void *cpdf_set_member(void *set, int member, int *status);
+    double cpdf_set_alphasQ2(void *set, double mu2, int *status);
+    void cpdf_set_uncertainty(void *set, int flavor, double x, double mu2, double cl,
+                              PDFUncertaintyC *result, int *status);
+    void cpdf_set_uncertainty_batch(void *set, int flavor, const double *x, const double *mu2,
+                                    int n, double cl, PDFUncertaintyC *result, int *status);
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "PDFxTMDLib/Common/ConfigWrapper.h"
 #include "PDFxTMDLib/Common/Exception.h"
+#include "PDFxTMDLib/Common/Instrumentation.h"
 #include "PDFxTMDLib/Common/PDFUtils.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
 #include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CContinuationExtrapolator.h"
@@ -12,6 +13,7 @@
 #include "PDFxTMDLib/Interface/IExtrapolator.h"
 #include "PDFxTMDLib/Interface/IInterpolator.h"
 #include "PDFxTMDLib/Interface/IReader.h"
+#include <PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h>
 #include <PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h>
 #include <algorithm>
 #include <array>
@@ -73,7 +75,20 @@ class GenericPDF
     GenericPDF(const std::string &pdfName, int setNumber)
         : m_pdfName(pdfName), m_setNumber(setNumber)
     {
-        loadStandardInfo();
+        auto metadataPair = SetMetadataReader(m_pdfName);
+        if (metadataPair.second != ErrorType::None)
+            throw FileLoadException("Unable to find info file of PDF set " + m_pdfName);
+        loadStandardInfo(*metadataPair.first);
+        loadData();
+    }
+    /**
+     * @brief Creates a member of the set described by @p metadata without reading its info file
+     * again.
+     */
+    GenericPDF(const SetMetadata &metadata, int setNumber)
+        : m_pdfName(metadata.pdfSetName), m_setNumber(setNumber)
+    {
+        loadStandardInfo(metadata);
         loadData();
     }
     ~GenericPDF() = default;
@@ -89,7 +104,11 @@ class GenericPDF
         if constexpr (std::is_same_v<Tag, CollinearPDFTag>)
         {
             if (isInRange(m_reader, x, mu2))
+            {
+                PDFXTMD_INSTRUMENT(m_counters, Interpolate);
                 return m_interpolator.interpolate(flavor, x, mu2);
+            }
+            PDFXTMD_INSTRUMENT(m_counters, Extrapolate);
             return m_extrapolator.extrapolate(flavor, x, mu2);
         }
         else
@@ -115,7 +134,11 @@ class GenericPDF
         if constexpr (std::is_same_v<Tag, CollinearPDFTag>)
         {
             if (isInRange(m_reader, x, mu2))
+            {
+                PDFXTMD_INSTRUMENT(m_counters, Interpolate);
                 return m_interpolator.interpolate(x, mu2, output);
+            }
+            PDFXTMD_INSTRUMENT(m_counters, Extrapolate);
             return m_extrapolator.extrapolate(x, mu2, output);
         }
         else
@@ -129,6 +152,9 @@ class GenericPDF
           m_reader(std::move(other.m_reader)), m_interpolator(std::move(other.m_interpolator)),
           m_extrapolator(std::move(other.m_extrapolator)), m_stdInfo(std::move(other.m_stdInfo))
     {
+#ifdef PDFXTMD_INSTRUMENTATION
+        m_counters = std::move(other.m_counters);
+#endif
         m_interpolator.initialize(&m_reader);
         if constexpr (std::is_base_of_v<IcAdvancedPDFExtrapolator<Extrapolator>, Extrapolator>)
         {
@@ -147,6 +173,9 @@ class GenericPDF
         m_interpolator = std::move(other.m_interpolator);
         m_extrapolator = std::move(other.m_extrapolator);
         m_stdInfo = std::move(other.m_stdInfo);
+#ifdef PDFXTMD_INSTRUMENTATION
+        m_counters = std::move(other.m_counters);
+#endif
 
         // Re-initialize internal dependencies
         m_interpolator.initialize(&m_reader);
@@ -162,6 +191,9 @@ class GenericPDF
           m_interpolator(other.m_interpolator), m_extrapolator(other.m_extrapolator),
           m_stdInfo(other.m_stdInfo)
     {
+#ifdef PDFXTMD_INSTRUMENTATION
+        m_counters = other.m_counters;
+#endif
         m_interpolator.initialize(&m_reader);
         if constexpr (std::is_base_of_v<IcAdvancedPDFExtrapolator<Extrapolator>, Extrapolator>)
         {
@@ -180,6 +212,9 @@ class GenericPDF
         m_interpolator = other.m_interpolator;
         m_extrapolator = other.m_extrapolator;
         m_stdInfo = other.m_stdInfo;
+#ifdef PDFXTMD_INSTRUMENTATION
+        m_counters = other.m_counters;
+#endif
 
         // Re-initialize internal dependencies
         m_interpolator.initialize(&m_reader);
@@ -196,13 +231,16 @@ class GenericPDF
      * @param x Bjorken x variable (momentum fraction)
      * @param kt2 Transverse momentum squared
      */
-    double tmd(PartonFlavor flavor, double x, double kt2, double mu2)
+    double tmd(PartonFlavor flavor, double x, double kt2, double mu2) const
     {
         if constexpr (std::is_same_v<Tag, TMDPDFTag>)
         {
             if (isInRange(m_reader, x, kt2, mu2))
+            {
+                PDFXTMD_INSTRUMENT(m_counters, Interpolate);
                 return m_interpolator.interpolate(flavor, x, kt2, mu2);
-
+            }
+            PDFXTMD_INSTRUMENT(m_counters, Extrapolate);
             return m_extrapolator.extrapolate(flavor, x, kt2, mu2);
         }
         else
@@ -223,12 +261,18 @@ class GenericPDF
      *
      * @throws std::logic_error If called on a PDF type that doesn't support TMD
      */
-    void tmd(double x, double kt2, double mu2, std::array<double, DEFAULT_TOTAL_PDFS> &output)
+    void tmd(double x, double kt2, double mu2, std::array<double, DEFAULT_TOTAL_PDFS> &output) const
     {
         if constexpr (std::is_same_v<Tag, TMDPDFTag>)
         {
-            isInRange(m_reader, x, kt2, mu2) ? m_interpolator.interpolate(x, kt2, mu2, output)
-                                             : m_extrapolator.extrapolate(x, kt2, mu2, output);
+            if (isInRange(m_reader, x, kt2, mu2))
+            {
+                PDFXTMD_INSTRUMENT(m_counters, Interpolate);
+                m_interpolator.interpolate(x, kt2, mu2, output);
+                return;
+            }
+            PDFXTMD_INSTRUMENT(m_counters, Extrapolate);
+            m_extrapolator.extrapolate(x, kt2, mu2, output);
         }
         else
         {
@@ -237,42 +281,112 @@ class GenericPDF
         }
     }
     /**
-     * @brief Retrieves the standard PDF info
+     * @brief Evaluates the TMD PDF of @p flavor at the @p n points (x[i], kt2[i], mu2[i])
      *
-     * @return YamlStandardTMDInfo The standard PDF info
+     * Runs of points inside the grid are passed to the interpolator in one call, the others are
+     * extrapolated one by one.
+     *
+     * @param output The array of @p n TMD PDF values
+     *
+     * @throws std::logic_error If called on a PDF type that doesn't support TMD
      */
-    YamlStandardTMDInfo getStdPDFInfo() const
-    {
-        return m_stdInfo;
-    }
-
-  private:
-    void loadStandardInfo()
+    void tmd(PartonFlavor flavor, const double *x, const double *kt2, const double *mu2,
+             double *output, size_t n) const
     {
-        auto infoPathPair = StandardInfoFilePath(m_pdfName);
-        if (infoPathPair.second != ErrorType::None)
-            throw FileLoadException("Unable to find info file of PDF set " + m_pdfName);
         if constexpr (std::is_same_v<Tag, TMDPDFTag>)
         {
-            auto pdfStandardInfo = YamlStandardPDFInfoReader(*infoPathPair.first);
-            if (pdfStandardInfo.second != ErrorType::None)
-                throw InvalidFormatException("Invalid standard info file " + *infoPathPair.first);
-            m_stdInfo = *pdfStandardInfo.first;
+            size_t i = 0;
+            while (i < n)
+            {
+                size_t end = i;
+                while (end < n && isInRange(m_reader, x[end], kt2[end], mu2[end]))
+                    ++end;
+                if (end > i)
+                {
+                    PDFXTMD_INSTRUMENT_N(m_counters, Interpolate, end - i);
+                    if constexpr (HasBatchTMDInterpolate<Interpolator>::value)
+                    {
+                        m_interpolator.interpolate(flavor, x + i, kt2 + i, mu2 + i, output + i,
+                                                   end - i);
+                    }
+                    else
+                    {
+                        for (size_t j = i; j < end; ++j)
+                            output[j] = m_interpolator.interpolate(flavor, x[j], kt2[j], mu2[j]);
+                    }
+                }
+                if (end < n)
+                {
+                    PDFXTMD_INSTRUMENT(m_counters, Extrapolate);
+                    output[end] = m_extrapolator.extrapolate(flavor, x[end], kt2[end], mu2[end]);
+                }
+                i = end + 1;
+            }
         }
-        else if constexpr (std::is_same_v<Tag, CollinearPDFTag>)
+        else
         {
-            auto pdfStandardInfo = YamlStandardPDFInfoReader(*infoPathPair.first);
-            if (pdfStandardInfo.second != ErrorType::None)
-                throw InvalidFormatException("Invalid standard info file " + *infoPathPair.first);
-            m_stdInfo = *pdfStandardInfo.first;
+            throw std::logic_error("tmd(PartonFlavor, const double *, const double *, const "
+                                   "double *, double *, size_t) is not supported for this tag.");
+        }
+    }
+    /**
+     * @brief Evaluates the TMD PDF values for all flavors at the @p n points (x[i], kt2[i],
+     * mu2[i]), in the order of tmd(x, kt2, mu2, output)
+     *
+     * @throws std::logic_error If called on a PDF type that doesn't support TMD
+     */
+    void tmd(const double *x, const double *kt2, const double *mu2,
+             std::array<double, DEFAULT_TOTAL_PDFS> *output, size_t n) const
+    {
+        if constexpr (std::is_same_v<Tag, TMDPDFTag>)
+        {
+            for (size_t i = 0; i < n; ++i)
+                tmd(x[i], kt2[i], mu2[i], output[i]);
         }
         else
         {
-            static_assert(!std::is_same_v<Tag, Tag>, "Unsupported Tag");
+            throw std::logic_error("tmd(const double *, const double *, const double *, "
+                                   "std::array<double, 13> *, size_t) is not supported for this "
+                                   "tag.");
         }
     }
+    /**
+     * @brief Retrieves the standard PDF info
+     *
+     * @return YamlStandardTMDInfo The standard PDF info
+     */
+    YamlStandardTMDInfo getStdPDFInfo() const
+    {
+        return m_stdInfo;
+    }
+    /**
+     * @brief The reader holding the loaded grid of this member
+     */
+    const Reader &getReader() const
+    {
+        return m_reader;
+    }
+    /**
+     * @brief The interpolator, including any tables it precomputed from the grid
+     */
+    const Interpolator &getInterpolator() const
+    {
+        return m_interpolator;
+    }
+
+  private:
+    void loadStandardInfo(const SetMetadata &metadata)
+    {
+        if (metadata.standardInfo.second != ErrorType::None)
+            throw InvalidFormatException("Invalid standard info file " + metadata.infoPath);
+        m_stdInfo = *metadata.standardInfo.first;
+    }
     void loadData()
     {
+#ifdef PDFXTMD_INSTRUMENTATION
+        m_counters = Instrumentation::Counters(m_pdfName, m_setNumber);
+        Instrumentation::LoadTimer loadTimer(*m_counters);
+#endif
         m_reader.read(m_pdfName, m_setNumber);
         m_interpolator.initialize(&m_reader);
         if constexpr (std::is_same_v<Tag, CollinearPDFTag>)
@@ -282,13 +396,31 @@ class GenericPDF
                 m_extrapolator.setInterpolator(&m_interpolator);
             }
         }
+#ifdef PDFXTMD_INSTRUMENTATION
+        loadTimer.Finish(gridBytes());
+#endif
+    }
+#ifdef PDFXTMD_INSTRUMENTATION
+    /// Bytes of the grid and of the coefficient tables precomputed from it
+    size_t gridBytes() const
+    {
+        size_t bytes = 0;
+        if constexpr (HasMemoryUsage<std::decay_t<decltype(m_reader.getData())>>::value)
+            bytes += m_reader.getData().memoryUsage();
+        if constexpr (HasCoefficients<Interpolator>::value)
+            bytes += m_interpolator.getCoefficients().size() * sizeof(double);
+        return bytes;
     }
+#endif
     std::string m_pdfName;
     int m_setNumber;
     Reader m_reader;
     Interpolator m_interpolator;
     Extrapolator m_extrapolator;
     YamlStandardTMDInfo m_stdInfo;
+#ifdef PDFXTMD_INSTRUMENTATION
+    std::shared_ptr<PDFCounters> m_counters;
+#endif
 };
 
 // Convenient type aliases for common use cases
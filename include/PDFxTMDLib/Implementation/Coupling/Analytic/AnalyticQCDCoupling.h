@@ -1,6 +1,8 @@
 // taken from lhapdf
 #pragma once
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlCouplingInfo.h"
+#include <array>
+#include <cstddef>
 #include <map>
 
 namespace PDFxTMD
@@ -9,17 +11,48 @@ class AnalyticQCDCoupling
 {
   public:
     double AlphaQCDMu2(double mu2);
+    /// Evaluates alpha_s at @p n points @p mu2 into @p alphas.
+    void AlphaQCDMu2(const double *mu2, double *alphas, size_t n);
     void initialize(const YamlCouplingInfo &couplingInfo);
 
   private:
+    static constexpr int MaxNumFlavors = 6;
+
+    /// Everything in the analytic expansion that depends on the number of active flavours only,
+    /// computed with the same operation order as the per-call expressions it replaces.
+    struct NfConstants
+    {
+        bool hasLambda = false;
+        double lambda2 = 0;
+        double beta1 = 0;
+        double beta02 = 0;
+        double A = 0;   // 1 / beta0
+        double B = 0;   // beta1^2 / beta0^4
+        double a_21 = 0;
+        double C = 0;   // 1 / beta0^6
+        double beta12beta1 = 0;
+        double beta0beta1beta2x3 = 0;
+        double beta3 = 0;
+    };
+
     double lambdaQCD(int nf) const;
     void setLambda(unsigned int i, double lambda);
     void setFlavors();
+    void setupConstants();
+    int numFlavors(double q2) const;
+    const NfConstants &constants(int nf) const;
 
   private:
     std::map<int, double> m_lambdas;
     YamlCouplingInfo m_couplingInfo;
     int m_nfmin;
     int m_nfmax;
+
+    std::array<NfConstants, MaxNumFlavors + 1> m_nfConstants;
+    /// Squared flavour thresholds in ascending order, with the number of active flavours once
+    /// q2 lies above each of them
+    std::array<double, MaxNumFlavors + 1> m_thresholds2{};
+    std::array<int, MaxNumFlavors + 1> m_thresholdNf{};
+    int m_nThresholds = 0;
 };
-} // namespace PDFxTMD
\ No newline at end of file
+} // namespace PDFxTMD
@@ -2,24 +2,34 @@
 #pragma once
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlCouplingInfo.h"
 #include "PDFxTMDLib/Implementation/Coupling/Interpolation/InterpolateQCDCoupling.h"
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace PDFxTMD
 {
+/// Solves the renormalization group equation of alpha_s on a grid of Q2 knots and interpolates
+/// between them.
+///
+/// The equation is integrated in log(Q2) with an adaptive Dormand-Prince 5(4) method, and the
+/// knots are read off its dense output. A solved grid is shared by every coupling with the same
+/// parameters in the process, which keeps the 32 most recently used grids. It is also stored on
+/// disk when the environment variable PDFXTMD_ALPHAS_CACHE_DIR names a writable directory, so
+/// later processes skip the solve.
 class ODEQCDCoupling
 {
   public:
     double AlphaQCDMu2(double mu2);
+    /// Evaluates alpha_s at @p n points @p mu2 into @p alphas.
+    void AlphaQCDMu2(const double *mu2, double *alphas, size_t n);
     void initialize(const YamlCouplingInfo &couplingInfo);
 
   private:
     void _interpolate();
-    void _solve(double q2, double &t, double &y, const double allowed_relative, double h,
-                double accuracy) const;
+    void _setupKnots();
+    std::vector<double> _solve() const;
     double _decouple(double y, double t, unsigned int ni, unsigned int nf) const;
-    void _rk4(double &t, double &y, double h, const double allowed_change,
-              const std::vector<double> &bs) const;
-    double _derivative(double t, double y, const std::vector<double> &beta) const;
+    std::string _cacheKey() const;
 
   private:
     std::vector<double> m_mu2_vec;
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "PDFxTMDLib/Common/Instrumentation.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
 #include "PDFxTMDLib/Implementation/Reader/Collinear/CDefaultLHAPDFFileReader.h"
 #include "PDFxTMDLib/Interface/IExtrapolator.h"
@@ -12,6 +13,14 @@
 namespace PDFxTMD
 {
 
+// The ContinuationExtrapolator provides an implementation of the extrapolation used in the MSTW
+// standalone code (and LHAPDFv5 when using MSTW sets), G. Watt, October 2014.
+//
+// The knot boundaries are cached when the interpolator is set, together with the per-flavor
+// profiles at the fixed corner points (xMin/xMin1 x q2Min/1.01*q2Min/q2Max1/q2Max), so the regions
+// extrapolated in both x and q2 need no interpolation at all. The regions extrapolated in one
+// direction make one all-flavor interpolation per edge line; the interpolators give the same
+// values through both overloads, so the two extrapolate overloads agree.
 template <typename Interpolator>
 class CContinuationExtrapolator
     : public IcAdvancedPDFExtrapolator<CContinuationExtrapolator<Interpolator>>
@@ -20,252 +29,253 @@ class CContinuationExtrapolator
     void setInterpolator(const Interpolator *interpolator)
     {
         m_interpolator = interpolator;
-    }
-    void extrapolate(double x, double q2, std::array<double, DEFAULT_TOTAL_PDFS> &output) const
-    {
-        using namespace std;
-        // The ContinuationExtrapolator provides an implementation
-        // of the extrapolation used in the MSTW standalone code
-        // (and LHAPDFv5 when using MSTW sets), G. Watt, October
-        // 2014.
         auto *reader = m_interpolator->getReader();
-        const auto& xVals_ = reader->getValues(PhaseSpaceComponent::X);
-        const auto& q2Vals_ = reader->getValues(PhaseSpaceComponent::Q2);
-        const size_t nxknots = xVals_.size(); // total number of x knots (all
-                                                              // subgrids)
-        const size_t nq2knots = q2Vals_.size(); // total number of q2 knots (all
-                                                               // subgrids)
+        const auto &xVals_ = reader->getValues(PhaseSpaceComponent::X);
+        const auto &q2Vals_ = reader->getValues(PhaseSpaceComponent::Q2);
+        const size_t nxknots = xVals_.size();   // total number of x knots (all subgrids)
+        const size_t nq2knots = q2Vals_.size(); // total number of q2 knots (all subgrids)
 
-        const double xMin = xVals_.at(0);  // first x knot
-        const double xMin1 = xVals_.at(1); // second x knot
-        const double xMax = xVals_.at(nxknots - 1); // last x knot
+        m_xMin = xVals_.at(0);            // first x knot
+        m_xMin1 = xVals_.at(1);           // second x knot
+        m_xMax = xVals_.at(nxknots - 1);  // last x knot
+        m_q2Min = q2Vals_.at(0);          // first q2 knot
+        m_q2Min1 = 1.01 * m_q2Min;        // anchor of the low-q2 anomalous dimension
+        m_q2Max1 = q2Vals_.at(nq2knots - 2); // second-last q2 knot
+        m_q2Max = q2Vals_.at(nq2knots - 1);  // last q2 knot
 
-        const double q2Min = q2Vals_.at(0); // first q2 knot
-        const double q2Max1 = q2Vals_.at(nq2knots - 2); // second-last q2 knot
-        const double q2Max = q2Vals_.at(nq2knots - 1); // last q2 knot
+        m_logXMin = std::log(m_xMin);
+        m_logXMin1 = std::log(m_xMin1);
+        m_logQ2Max = std::log(m_q2Max);
+        m_logQ2Max1 = std::log(m_q2Max1);
 
-        double fxMin = 0, fxMin1 = 0, fq2Max = 0, fq2Max1 = 0, fq2Min = 0, fq2Min1 = 0, xpdf = 0,
-               anom = 0;
-        for (size_t i = 0; i < DEFAULT_TOTAL_PDFS; i += 1)
+        m_interpolator->interpolate(m_xMin, m_q2Max, m_fXMinQ2Max);
+        m_interpolator->interpolate(m_xMin, m_q2Max1, m_fXMinQ2Max1);
+        m_interpolator->interpolate(m_xMin1, m_q2Max, m_fXMin1Q2Max);
+        m_interpolator->interpolate(m_xMin1, m_q2Max1, m_fXMin1Q2Max1);
+        m_interpolator->interpolate(m_xMin, m_q2Min, m_fXMinQ2Min);
+        m_interpolator->interpolate(m_xMin1, m_q2Min, m_fXMin1Q2Min);
+        m_interpolator->interpolate(m_xMin, m_q2Min1, m_fXMinQ2Min1);
+        m_interpolator->interpolate(m_xMin1, m_q2Min1, m_fXMin1Q2Min1);
+    }
+    void extrapolate(double x, double q2, std::array<double, DEFAULT_TOTAL_PDFS> &output) const
+    {
+        std::array<double, DEFAULT_TOTAL_PDFS> fLow, fHigh;
+        const Region r = region(x, q2);
+        PDFXTMD_COUNT(counterOf(r));
+        switch (r)
         {
-            PartonFlavor flavor = standardPartonFlavors[i];
-            if (x < xMin && (q2 >= q2Min && q2 <= q2Max))
-            {
-                // Extrapolation in small x only.
-                fxMin = m_interpolator->interpolate(flavor, xMin, q2);   // PDF at (xMin,q2)
-                fxMin1 = m_interpolator->interpolate(flavor, xMin1, q2); // PDF at (xMin1,q2)
-                xpdf = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                          fxMin1); // PDF at (x,q2)
-            }
-            else if ((x >= xMin && x <= xMax) && q2 > q2Max)
-            {
-                // Extrapolation in large q2 only.
-                fq2Max = m_interpolator->interpolate(flavor, x, q2Max);   // PDF at (x,q2Max)
-                fq2Max1 = m_interpolator->interpolate(flavor, x, q2Max1); // PDF at (x,q2Max1)
-                xpdf = _extrapolateLinear(q2, q2Max, q2Max1, fq2Max,
-                                          fq2Max1); // PDF at (x,q2)
-            }
-            else if (x < xMin && q2 > q2Max)
+        case Region::SmallX: {
+            // Extrapolation in small x only.
+            m_interpolator->interpolate(m_xMin, q2, fLow);   // PDF at (xMin,q2)
+            m_interpolator->interpolate(m_xMin1, q2, fHigh); // PDF at (xMin1,q2)
+            const double logx = std::log(x);
+            for (size_t i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+                output[i] = _extrapolateLogLinear(logx, m_logXMin, m_logXMin1, fLow[i], fHigh[i]);
+            break;
+        }
+        case Region::LargeQ2: {
+            // Extrapolation in large q2 only.
+            m_interpolator->interpolate(x, m_q2Max, fLow);   // PDF at (x,q2Max)
+            m_interpolator->interpolate(x, m_q2Max1, fHigh); // PDF at (x,q2Max1)
+            const double logq2 = std::log(q2);
+            for (size_t i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+                output[i] =
+                    _extrapolateLogLinear(logq2, m_logQ2Max, m_logQ2Max1, fLow[i], fHigh[i]);
+            break;
+        }
+        case Region::SmallXLargeQ2: {
+            // Extrapolation in large q2 AND small x.
+            const double logx = std::log(x);
+            const double logq2 = std::log(q2);
+            for (size_t i = 0; i < DEFAULT_TOTAL_PDFS; i++)
             {
-                // Extrapolation in large q2 AND small x.
-                fq2Max = m_interpolator->interpolate(flavor, xMin, q2Max);   // PDF at (xMin,q2Max)
-                fq2Max1 = m_interpolator->interpolate(flavor, xMin, q2Max1); // PDF at (xMin,q2Max1)
-                fxMin = _extrapolateLinear(q2, q2Max, q2Max1, fq2Max,
-                                           fq2Max1);                        // PDF at (xMin,q2)
-                fq2Max = m_interpolator->interpolate(flavor, xMin1, q2Max); // PDF at (xMin1,q2Max)
-                fq2Max1 =
-                    m_interpolator->interpolate(flavor, xMin1, q2Max1); // PDF at (xMin1,q2Max1)
-                fxMin1 = _extrapolateLinear(q2, q2Max, q2Max1, fq2Max,
-                                            fq2Max1); // PDF at (xMin1,q2)
-                xpdf = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                          fxMin1); // PDF at (x,q2)
+                const double fxMin = _extrapolateLogLinear(
+                    logq2, m_logQ2Max, m_logQ2Max1, m_fXMinQ2Max[i], m_fXMinQ2Max1[i]);
+                const double fxMin1 = _extrapolateLogLinear(
+                    logq2, m_logQ2Max, m_logQ2Max1, m_fXMin1Q2Max[i], m_fXMin1Q2Max1[i]);
+                output[i] = _extrapolateLogLinear(logx, m_logXMin, m_logXMin1, fxMin, fxMin1);
             }
-            else if (q2 < q2Min && x <= xMax)
-            {
-                // Extrapolation in small q2.
-
-                if (x < xMin)
-                {
-                    // Extrapolation also in small x.
-
-                    fxMin = m_interpolator->interpolate(flavor, xMin, q2Min); // PDF at (xMin,q2Min)
-                    fxMin1 =
-                        m_interpolator->interpolate(flavor, xMin1, q2Min); // PDF at (xMin1,q2Min)
-                    fq2Min = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                                fxMin1); // PDF at (x,q2Min)
-                    fxMin = m_interpolator->interpolate(flavor, xMin,
-                                                        1.01 * q2Min); // PDF at (xMin,1.01*q2Min)
-                    fxMin1 = m_interpolator->interpolate(flavor, xMin1,
-                                                         1.01 * q2Min); // PDF at (xMin1,1.01*q2Min)
-                    fq2Min1 = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                                 fxMin1); // PDF at (x,1.01*q2Min)
-                }
-                else
-                {
-                    // Usual interpolation in x.
-
-                    fq2Min = m_interpolator->interpolate(flavor, x, q2Min); // PDF at (x,q2Min)
-                    fq2Min1 = m_interpolator->interpolate(flavor, x,
-                                                          1.01 * q2Min); // PDF at (x,1.01*q2Min)
-                }
-
-                // Calculate the anomalous dimension, dlog(f)/dlog(q2),
-                // evaluated at q2Min.  Then extrapolate the PDFs to low
-                // q2 < q2Min by interpolating the anomalous dimension
-                // between the value at q2Min and a value of 1 for q2 <<
-                // q2Min. If value of PDF at q2Min is very small, just
-                // set anomalous dimension to 1 to prevent rounding
-                // errors. Impose minimum anomalous dimension of -2.5.
-
-                if (fabs(fq2Min) >= 1e-5)
-                {
-                    // anom = dlog(f)/dlog(q2) = q2/f * df/dq2 evaluated
-                    // at q2 = q2Min, where derivative df/dq2 = (
-                    // f(1.01*q2Min) - f(q2Min) ) / (0.01*q2Min).
-                    anom = std::max(-2.5, (fq2Min1 - fq2Min) / fq2Min / 0.01);
-                }
-                else
-                    anom = 1.0;
-
-                // Interpolates between f(q2Min)*(q2/q2Min)^anom for q2
-                // ~ q2Min and f(q2Min)*(q2/q2Min) for q2 << q2Min, i.e.
-                // PDFs vanish as q2 --> 0.
-                xpdf = fq2Min * std::pow(q2 / q2Min, anom * q2 / q2Min + 1.0 - q2 / q2Min);
-            }
-            else if (x > xMax)
+            break;
+        }
+        case Region::SmallQ2SmallX: {
+            // Extrapolation in small q2, and also in small x.
+            const double logx = std::log(x);
+            for (size_t i = 0; i < DEFAULT_TOTAL_PDFS; i++)
             {
-                std::ostringstream oss;
-                oss << "Error in LHAPDF::ContinuationExtrapolator, x > "
-                       "xMax (last x knot): ";
-                oss << std::scientific << x << " > " << xMax;
-                throw std::runtime_error(oss.str());
+                const double fq2Min = _extrapolateLogLinear(
+                    logx, m_logXMin, m_logXMin1, m_fXMinQ2Min[i], m_fXMin1Q2Min[i]);
+                const double fq2Min1 = _extrapolateLogLinear(
+                    logx, m_logXMin, m_logXMin1, m_fXMinQ2Min1[i], m_fXMin1Q2Min1[i]);
+                output[i] = _extrapolateSmallQ2(q2, fq2Min, fq2Min1);
             }
-            else
-                throw std::runtime_error("We shouldn't be able to get here!");
-
-            output[i] = xpdf;
+            break;
+        }
+        case Region::SmallQ2: {
+            // Extrapolation in small q2, usual interpolation in x.
+            m_interpolator->interpolate(x, m_q2Min, fLow);   // PDF at (x,q2Min)
+            m_interpolator->interpolate(x, m_q2Min1, fHigh); // PDF at (x,1.01*q2Min)
+            for (size_t i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+                output[i] = _extrapolateSmallQ2(q2, fLow[i], fHigh[i]);
+            break;
+        }
         }
     }
     double extrapolate(PartonFlavor flavor, double x, double q2) const
     {
-        using namespace std;
-        // The ContinuationExtrapolator provides an implementation
-        // of the extrapolation used in the MSTW standalone code
-        // (and LHAPDFv5 when using MSTW sets), G. Watt, October
-        // 2014.
-        auto *reader = m_interpolator->getReader();
-        const auto& xVals_ = reader->getValues(PhaseSpaceComponent::X);
-        const auto& q2Vals_ = reader->getValues(PhaseSpaceComponent::Q2);
-        const size_t nxknots = xVals_.size(); // total number of x knots (all
-                                                              // subgrids)
-        const size_t nq2knots = q2Vals_.size(); // total number of q2 knots (all
-                                                               // subgrids)
-        const double xMin = xVals_.at(0);  // first x knot
-        const double xMin1 = xVals_.at(1); // second x knot
-        const double xMax = xVals_.at(nxknots - 1); // last x knot
-
-        const double q2Min = q2Vals_.at(0); // first q2 knot
-        const double q2Max1 = q2Vals_.at(nq2knots - 2); // second-last q2 knot
-        const double q2Max = q2Vals_.at(nq2knots - 1); // last q2 knot
+        const int i = _standardFlavorIndex(flavor);
+        double fxMin, fxMin1, fq2Max, fq2Max1, fq2Min, fq2Min1;
 
-        double fxMin, fxMin1, fq2Max, fq2Max1, fq2Min, fq2Min1, xpdf, anom;
-
-        if (x < xMin && (q2 >= q2Min && q2 <= q2Max))
+        const Region r = region(x, q2);
+        PDFXTMD_COUNT(counterOf(r));
+        switch (r)
         {
+        case Region::SmallX:
             // Extrapolation in small x only.
-            fxMin = m_interpolator->interpolate(flavor, xMin, q2);   // PDF at (xMin,q2)
-            fxMin1 = m_interpolator->interpolate(flavor, xMin1, q2); // PDF at (xMin1,q2)
-            xpdf = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                      fxMin1); // PDF at (x,q2)
-        }
-        else if ((x >= xMin && x <= xMax) && q2 > q2Max)
-        {
+            fxMin = m_interpolator->interpolate(flavor, m_xMin, q2);   // PDF at (xMin,q2)
+            fxMin1 = m_interpolator->interpolate(flavor, m_xMin1, q2); // PDF at (xMin1,q2)
+            return _extrapolateLogLinear(std::log(x), m_logXMin, m_logXMin1, fxMin, fxMin1);
+        case Region::LargeQ2:
             // Extrapolation in large q2 only.
-            fq2Max = m_interpolator->interpolate(flavor, x, q2Max);   // PDF at (x,q2Max)
-            fq2Max1 = m_interpolator->interpolate(flavor, x, q2Max1); // PDF at (x,q2Max1)
-            xpdf = _extrapolateLinear(q2, q2Max, q2Max1, fq2Max,
-                                      fq2Max1); // PDF at (x,q2)
-        }
-        else if (x < xMin && q2 > q2Max)
-        {
+            fq2Max = m_interpolator->interpolate(flavor, x, m_q2Max);   // PDF at (x,q2Max)
+            fq2Max1 = m_interpolator->interpolate(flavor, x, m_q2Max1); // PDF at (x,q2Max1)
+            return _extrapolateLogLinear(std::log(q2), m_logQ2Max, m_logQ2Max1, fq2Max, fq2Max1);
+        case Region::SmallXLargeQ2: {
             // Extrapolation in large q2 AND small x.
-            fq2Max = m_interpolator->interpolate(flavor, xMin, q2Max);   // PDF at (xMin,q2Max)
-            fq2Max1 = m_interpolator->interpolate(flavor, xMin, q2Max1); // PDF at (xMin,q2Max1)
-            fxMin = _extrapolateLinear(q2, q2Max, q2Max1, fq2Max,
-                                       fq2Max1);                          // PDF at (xMin,q2)
-            fq2Max = m_interpolator->interpolate(flavor, xMin1, q2Max);   // PDF at (xMin1,q2Max)
-            fq2Max1 = m_interpolator->interpolate(flavor, xMin1, q2Max1); // PDF at (xMin1,q2Max1)
-            fxMin1 = _extrapolateLinear(q2, q2Max, q2Max1, fq2Max,
-                                        fq2Max1); // PDF at (xMin1,q2)
-            xpdf = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                      fxMin1); // PDF at (x,q2)
+            const double logq2 = std::log(q2);
+            fxMin = _extrapolateLogLinear(logq2, m_logQ2Max, m_logQ2Max1,
+                                          corner(m_fXMinQ2Max, i, flavor, m_xMin, m_q2Max),
+                                          corner(m_fXMinQ2Max1, i, flavor, m_xMin, m_q2Max1));
+            fxMin1 = _extrapolateLogLinear(logq2, m_logQ2Max, m_logQ2Max1,
+                                           corner(m_fXMin1Q2Max, i, flavor, m_xMin1, m_q2Max),
+                                           corner(m_fXMin1Q2Max1, i, flavor, m_xMin1, m_q2Max1));
+            return _extrapolateLogLinear(std::log(x), m_logXMin, m_logXMin1, fxMin, fxMin1);
         }
-        else if (q2 < q2Min && x <= xMax)
-        {
-            // Extrapolation in small q2.
+        case Region::SmallQ2SmallX: {
+            // Extrapolation in small q2, and also in small x.
+            const double logx = std::log(x);
+            fq2Min = _extrapolateLogLinear(logx, m_logXMin, m_logXMin1,
+                                           corner(m_fXMinQ2Min, i, flavor, m_xMin, m_q2Min),
+                                           corner(m_fXMin1Q2Min, i, flavor, m_xMin1, m_q2Min));
+            fq2Min1 = _extrapolateLogLinear(logx, m_logXMin, m_logXMin1,
+                                            corner(m_fXMinQ2Min1, i, flavor, m_xMin, m_q2Min1),
+                                            corner(m_fXMin1Q2Min1, i, flavor, m_xMin1, m_q2Min1));
+            return _extrapolateSmallQ2(q2, fq2Min, fq2Min1);
+        }
+        case Region::SmallQ2:
+            // Extrapolation in small q2, usual interpolation in x.
+            fq2Min = m_interpolator->interpolate(flavor, x, m_q2Min);   // PDF at (x,q2Min)
+            fq2Min1 = m_interpolator->interpolate(flavor, x, m_q2Min1); // PDF at (x,1.01*q2Min)
+            return _extrapolateSmallQ2(q2, fq2Min, fq2Min1);
+        }
+        throw std::runtime_error("We shouldn't be able to get here!");
+    }
 
-            if (x < xMin)
-            {
-                // Extrapolation also in small x.
+  private:
+    enum class Region
+    {
+        SmallX,
+        LargeQ2,
+        SmallXLargeQ2,
+        SmallQ2SmallX,
+        SmallQ2
+    };
 
-                fxMin = m_interpolator->interpolate(flavor, xMin, q2Min);   // PDF at (xMin,q2Min)
-                fxMin1 = m_interpolator->interpolate(flavor, xMin1, q2Min); // PDF at (xMin1,q2Min)
-                fq2Min = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                            fxMin1); // PDF at (x,q2Min)
-                fxMin = m_interpolator->interpolate(flavor, xMin,
-                                                    1.01 * q2Min); // PDF at (xMin,1.01*q2Min)
-                fxMin1 = m_interpolator->interpolate(flavor, xMin1,
-                                                     1.01 * q2Min); // PDF at (xMin1,1.01*q2Min)
-                fq2Min1 = _extrapolateLinear(x, xMin, xMin1, fxMin,
-                                             fxMin1); // PDF at (x,1.01*q2Min)
-            }
-            else
-            {
-                // Usual interpolation in x.
+    Region region(double x, double q2) const
+    {
+        if (x < m_xMin && (q2 >= m_q2Min && q2 <= m_q2Max))
+            return Region::SmallX;
+        if ((x >= m_xMin && x <= m_xMax) && q2 > m_q2Max)
+            return Region::LargeQ2;
+        if (x < m_xMin && q2 > m_q2Max)
+            return Region::SmallXLargeQ2;
+        if (q2 < m_q2Min && x <= m_xMax)
+            return (x < m_xMin) ? Region::SmallQ2SmallX : Region::SmallQ2;
+        if (x > m_xMax)
+        {
+            std::ostringstream oss;
+            oss << "Error in LHAPDF::ContinuationExtrapolator, x > "
+                   "xMax (last x knot): ";
+            oss << std::scientific << x << " > " << m_xMax;
+            throw std::runtime_error(oss.str());
+        }
+        throw std::runtime_error("We shouldn't be able to get here!");
+    }
 
-                fq2Min = m_interpolator->interpolate(flavor, x, q2Min); // PDF at (x,q2Min)
-                fq2Min1 = m_interpolator->interpolate(flavor, x,
-                                                      1.01 * q2Min); // PDF at (x,1.01*q2Min)
-            }
+    static constexpr InstrumentationCounter counterOf(Region r)
+    {
+        constexpr InstrumentationCounter counters[] = {
+            InstrumentationCounter::ContinuationSmallX,
+            InstrumentationCounter::ContinuationLargeQ2,
+            InstrumentationCounter::ContinuationSmallXLargeQ2,
+            InstrumentationCounter::ContinuationSmallQ2SmallX,
+            InstrumentationCounter::ContinuationSmallQ2};
+        return counters[static_cast<size_t>(r)];
+    }
 
-            // Calculate the anomalous dimension, dlog(f)/dlog(q2),
-            // evaluated at q2Min.  Then extrapolate the PDFs to low
-            // q2 < q2Min by interpolating the anomalous dimension
-            // between the value at q2Min and a value of 1 for q2 <<
-            // q2Min. If value of PDF at q2Min is very small, just
-            // set anomalous dimension to 1 to prevent rounding
-            // errors. Impose minimum anomalous dimension of -2.5.
+    /// Value of a cached corner profile, or a direct interpolation for flavors outside the
+    /// standard 13.
+    double corner(const std::array<double, DEFAULT_TOTAL_PDFS> &profile, int index,
+                  PartonFlavor flavor, double x, double q2) const
+    {
+        return (index >= 0) ? profile[index] : m_interpolator->interpolate(flavor, x, q2);
+    }
 
-            if (fabs(fq2Min) >= 1e-5)
-            {
-                // anom = dlog(f)/dlog(q2) = q2/f * df/dq2 evaluated
-                // at q2 = q2Min, where derivative df/dq2 = (
-                // f(1.01*q2Min) - f(q2Min) ) / (0.01*q2Min).
-                anom = std::max(-2.5, (fq2Min1 - fq2Min) / fq2Min / 0.01);
-            }
-            else
-                anom = 1.0;
+    static int _standardFlavorIndex(PartonFlavor flavor)
+    {
+        if (flavor == PartonFlavor::g)
+            return 6;
+        const int id = static_cast<int>(flavor);
+        return (-6 <= id && id <= 6) ? id + 6 : -1;
+    }
 
-            // Interpolates between f(q2Min)*(q2/q2Min)^anom for q2
-            // ~ q2Min and f(q2Min)*(q2/q2Min) for q2 << q2Min, i.e.
-            // PDFs vanish as q2 --> 0.
-            xpdf = fq2Min * std::pow(q2 / q2Min, anom * q2 / q2Min + 1.0 - q2 / q2Min);
+    /// Same as _extrapolateLinear, with the logarithms of the abscissae supplied by the caller.
+    static double _extrapolateLogLinear(double logx, double logxl, double logxh, double yl,
+                                        double yh)
+    {
+        if (yl > 1e-3 && yh > 1e-3)
+        {
+            // If yl and yh are sufficiently positive, keep y positive
+            // by extrapolating log(y).
+            return std::exp(std::log(yl) + (logx - logxl) / (logxh - logxl) *
+                                               (std::log(yh) - std::log(yl)));
         }
-        else if (x > xMax)
+        // Otherwise just extrapolate y itself.
+        return yl + (logx - logxl) / (logxh - logxl) * (yh - yl);
+    }
+
+    double _extrapolateSmallQ2(double q2, double fq2Min, double fq2Min1) const
+    {
+        // Calculate the anomalous dimension, dlog(f)/dlog(q2),
+        // evaluated at q2Min.  Then extrapolate the PDFs to low
+        // q2 < q2Min by interpolating the anomalous dimension
+        // between the value at q2Min and a value of 1 for q2 <<
+        // q2Min. If value of PDF at q2Min is very small, just
+        // set anomalous dimension to 1 to prevent rounding
+        // errors. Impose minimum anomalous dimension of -2.5.
+        double anom;
+        if (std::fabs(fq2Min) >= 1e-5)
         {
-            std::ostringstream oss;
-            oss << "Error in LHAPDF::ContinuationExtrapolator, x > "
-                   "xMax (last x knot): ";
-            oss << std::scientific << x << " > " << xMax;
-            throw std::runtime_error(oss.str());
+            // anom = dlog(f)/dlog(q2) = q2/f * df/dq2 evaluated
+            // at q2 = q2Min, where derivative df/dq2 = (
+            // f(1.01*q2Min) - f(q2Min) ) / (0.01*q2Min).
+            anom = std::max(-2.5, (fq2Min1 - fq2Min) / fq2Min / 0.01);
         }
         else
-            throw std::runtime_error("We shouldn't be able to get here!");
+            anom = 1.0;
 
-        return xpdf;
+        // Interpolates between f(q2Min)*(q2/q2Min)^anom for q2
+        // ~ q2Min and f(q2Min)*(q2/q2Min) for q2 << q2Min, i.e.
+        // PDFs vanish as q2 --> 0.
+        return fq2Min * std::pow(q2 / m_q2Min, anom * q2 / m_q2Min + 1.0 - q2 / m_q2Min);
     }
 
-  private:
     const Interpolator *m_interpolator = nullptr;
+    double m_xMin = 0, m_xMin1 = 0, m_xMax = 0;
+    double m_q2Min = 0, m_q2Min1 = 0, m_q2Max1 = 0, m_q2Max = 0;
+    double m_logXMin = 0, m_logXMin1 = 0, m_logQ2Max = 0, m_logQ2Max1 = 0;
+    std::array<double, DEFAULT_TOTAL_PDFS> m_fXMinQ2Max{}, m_fXMinQ2Max1{}, m_fXMin1Q2Max{},
+        m_fXMin1Q2Max1{};
+    std::array<double, DEFAULT_TOTAL_PDFS> m_fXMinQ2Min{}, m_fXMin1Q2Min{}, m_fXMinQ2Min1{},
+        m_fXMin1Q2Min1{};
 };
-} // namespace PDFxTMD
\ No newline at end of file
+} // namespace PDFxTMD
@@ -37,8 +37,8 @@ class CNearestPointExtrapolator
         /// off-grid, and use the current interpolator
         /// @todo raise error for x > 1 ?
         const auto *reader = m_interpolator->getReader();
-        auto xVals = reader->getValues(PhaseSpaceComponent::X);
-        auto q2Vals = reader->getValues(PhaseSpaceComponent::Q2);
+        const auto &xVals = reader->getValues(PhaseSpaceComponent::X);
+        const auto &q2Vals = reader->getValues(PhaseSpaceComponent::Q2);
 
         const double closestX = (isInRangeX(*reader, x)) ? x : _findClosestMatch(xVals, x);
         const double closestQ2 = (isInRangeQ2(*reader, mu2)) ? mu2 : _findClosestMatch(q2Vals, mu2);
@@ -51,8 +51,8 @@ class CNearestPointExtrapolator
         /// off-grid, and use the current interpolator
         /// @todo raise error for x > 1 ?
         const auto *reader = m_interpolator->getReader();
-        auto xVals = reader->getValues(PhaseSpaceComponent::X);
-        auto q2Vals = reader->getValues(PhaseSpaceComponent::Q2);
+        const auto &xVals = reader->getValues(PhaseSpaceComponent::X);
+        const auto &q2Vals = reader->getValues(PhaseSpaceComponent::Q2);
 
         const double closestX = (isInRangeX(*reader, x)) ? x : _findClosestMatch(xVals, x);
         const double closestQ2 = (isInRangeQ2(*reader, mu2)) ? mu2 : _findClosestMatch(q2Vals, mu2);
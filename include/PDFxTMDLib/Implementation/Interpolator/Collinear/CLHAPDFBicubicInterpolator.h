@@ -1,6 +1,7 @@
 #pragma once
 #include "PDFxTMDLib/Implementation/Reader/Collinear/CDefaultLHAPDFFileReader.h"
 #include "PDFxTMDLib/Interface/IInterpolator.h"
+#include <memory>
 #include <vector>
 
 // taken from lhapdf library!
@@ -18,10 +19,15 @@ class CLHAPDFBicubicInterpolator
     void interpolate(double x, double q2, std::array<double, DEFAULT_TOTAL_PDFS> &output) const;
     void initialize(const IReader<Reader> *reader);
     const IReader<Reader> *getReader() const;
+    /// Bicubic polynomial coefficients, stored as [x interval][mu2][flavor][4]
+    const std::vector<double> &getCoefficients() const;
 
   private:
     const IReader<Reader> *m_reader;
-    mutable DefaultAllFlavorShape m_Shape;
+    // Coefficients derived from the reader's grid, shared by copies of the interpolator
+    std::shared_ptr<const DefaultAllFlavorShape> m_Shape;
+    // Reader grid the coefficients were derived from; expires with it
+    std::weak_ptr<const DefaultAllFlavorShape> m_sourceGrid;
 };
 } // namespace PDFxTMD
 #include "./CLHAPDFBicubicInterpolator.tpp"
@@ -1,4 +1,5 @@
 #include "CLHAPDFBicubicInterpolator.h"
+#include "PDFxTMDLib/Common/Instrumentation.h"
 #include <cassert>
 #if defined(_M_X64) || defined(_M_IX86)
 #include <immintrin.h> // For AVX intrinsics
@@ -143,6 +144,7 @@ inline double _interpolate(const DefaultAllFlavorShape &grid, size_t ix, size_t
 inline double _interpolateFallback(const DefaultAllFlavorShape &grid, size_t ix, size_t iq2,
                                    PartonFlavor flavor, shared_data &_share)
 {
+    PDFXTMD_COUNT(InstrumentationCounter::InterpolateFallback);
     int flavorId = grid.get_pid(static_cast<int>(flavor));
     if (flavorId == -1)
         return 0.0;
@@ -158,15 +160,30 @@ template <class Reader>
 void CLHAPDFBicubicInterpolator<Reader>::initialize(const IReader<Reader> *reader)
 {
     m_reader = reader;
-    m_Shape = reader->getData();
-    m_Shape.initializeBicubicCoeficient();
-    m_Shape.grids.clear();
+    std::shared_ptr<const DefaultAllFlavorShape> sourceGrid = reader->getSharedData();
+    // Copies and moves of a PDF keep the reader's shared grid, so the coefficients still match.
+    // A grid that was freed never matches, even if a new one reuses its address.
+    if (m_Shape && sourceGrid && m_sourceGrid.lock() == sourceGrid)
+        return;
+    auto shape = std::make_shared<DefaultAllFlavorShape>(*sourceGrid);
+    shape->initializeBicubicCoeficient();
+    shape->grids.clear();
+    // Only the coefficients are kept here; the fallback reads the knot values from the reader.
+    shape->grids_flat.clear();
+    shape->grids_flat.shrink_to_fit();
+    m_Shape = std::move(shape);
+    m_sourceGrid = sourceGrid;
 }
 template <class Reader>
 const IReader<Reader> *CLHAPDFBicubicInterpolator<Reader>::getReader() const
 {
     return m_reader;
 }
+template <class Reader>
+const std::vector<double> &CLHAPDFBicubicInterpolator<Reader>::getCoefficients() const
+{
+    return m_Shape->coefficients_flat;
+}
 
 inline void _checkGridSize(const DefaultAllFlavorShape &grid, const size_t ix, const size_t iq2)
 {
@@ -179,32 +196,35 @@ template <class Reader>
 void CLHAPDFBicubicInterpolator<Reader>::interpolate(double x, double mu2,
                                              std::array<double, 13> &output) const
 {
-    const size_t ix = indexbelow(x, m_Shape.x_vec);
-    const size_t imu2 = indexbelow(mu2, m_Shape.mu2_vec);
-    shared_data shared = fillBicubic(m_Shape, x, mu2, ix, imu2);
-    _checkGridSize(m_Shape, ix, imu2);
+    const size_t ix = indexbelow(x, m_Shape->x_vec);
+    const size_t imu2 = indexbelow(mu2, m_Shape->mu2_vec);
+    shared_data shared = fillBicubic(*m_Shape, x, mu2, ix, imu2);
+    _checkGridSize(*m_Shape, ix, imu2);
     size_t i = 0;
     for (i = 0; i < DEFAULT_TOTAL_PDFS; i++)
     {
-        if (!shared.q2_lower || !shared.q2_upper)
+        // Same condition as the single-flavor overload, so both give the same values
+        if (shared.q2_edge == 0)
         {
-            output[i] = _interpolate(m_Shape, ix, imu2, standardPartonFlavors[i], shared);
+            output[i] = _interpolate(*m_Shape, ix, imu2, standardPartonFlavors[i], shared);
         }
         else
         {
-            output[i] = _interpolateFallback(m_Shape, ix, imu2, standardPartonFlavors[i], shared);
+            output[i] = _interpolateFallback(m_reader->getData(), ix, imu2,
+                                             standardPartonFlavors[i], shared);
         }
     }
 }
 template <class Reader>
 double CLHAPDFBicubicInterpolator<Reader>::interpolate(PartonFlavor flavor, double x, double mu2) const
 {
-    const size_t ix = indexbelow(x, m_Shape.x_vec);
-    const size_t imu2 = indexbelow(mu2, m_Shape.mu2_vec);
-    _checkGridSize(m_Shape, ix, imu2);
-    shared_data shared = fillBicubic(m_Shape, x, mu2, ix, imu2);
-    return (shared.q2_edge == 0) ? _interpolate(m_Shape, ix, imu2, flavor, shared)
-                                 : _interpolateFallback(m_Shape, ix, imu2, flavor, shared);
+    const size_t ix = indexbelow(x, m_Shape->x_vec);
+    const size_t imu2 = indexbelow(mu2, m_Shape->mu2_vec);
+    _checkGridSize(*m_Shape, ix, imu2);
+    shared_data shared = fillBicubic(*m_Shape, x, mu2, ix, imu2);
+    return (shared.q2_edge == 0) ? _interpolate(*m_Shape, ix, imu2, flavor, shared)
+                                 : _interpolateFallback(m_reader->getData(), ix, imu2, flavor,
+                                                        shared);
 }
 
 } // namespace PDFxTMD
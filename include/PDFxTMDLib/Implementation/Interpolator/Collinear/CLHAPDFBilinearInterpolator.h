@@ -21,7 +21,8 @@ class CLHAPDFBilinearInterpolator
 
   private:
     const IReader<ReaderType> *m_reader;
-    mutable DefaultAllFlavorShape m_Shape;
+    // Grid owned by the reader, used in place without a copy.
+    const DefaultAllFlavorShape *m_Shape = nullptr;
 };
 } // namespace PDFxTMD
 #include "./CLHAPDFBilinearInterpolator.tpp"
\ No newline at end of file
@@ -43,11 +43,15 @@ inline double _interpolateLinear(double x, double xl, double xh, double yl, doub
 inline double _interpolate(const DefaultAllFlavorShape &grid, size_t ix, size_t iq2,
                            PartonFlavor flavor, const shared_dataLinear& _share)
 {
-    const double f_ql = _interpolateLinear(_share.logx, _share.logx0, _share.logx1,
-                                           grid.xf(ix, iq2, flavor), grid.xf(ix + 1, iq2, flavor));
+    const int flavorId = grid.get_pid(static_cast<int>(flavor));
+    if (flavorId == -1)
+        return 0.0;
+    const double f_ql =
+        _interpolateLinear(_share.logx, _share.logx0, _share.logx1, grid.xf(ix, iq2, flavorId),
+                           grid.xf(ix + 1, iq2, flavorId));
     const double f_qh =
-        _interpolateLinear(_share.logx, _share.logx0, _share.logx1, grid.xf(ix, iq2 + 1, flavor),
-                           grid.xf(ix + 1, iq2 + 1, flavor));
+        _interpolateLinear(_share.logx, _share.logx0, _share.logx1, grid.xf(ix, iq2 + 1, flavorId),
+                           grid.xf(ix + 1, iq2 + 1, flavorId));
     // Then interpolate in Q2, using the x-ipol results as anchor points
     return _interpolateLinear(_share.logq2, grid.log_mu2_vec.at(iq2), grid.log_mu2_vec.at(iq2 + 1),
                               f_ql, f_qh);
@@ -58,7 +62,7 @@ template <class ReaderType>
 void CLHAPDFBilinearInterpolator<ReaderType>::initialize(const IReader<ReaderType> *reader)
 {
     m_reader = reader;
-    m_Shape = reader->getData();
+    m_Shape = &reader->getData();
 }
 template<class ReaderType>
 const IReader<ReaderType> *CLHAPDFBilinearInterpolator<ReaderType>::getReader() const
@@ -69,20 +73,20 @@ template<class ReaderType>
 void CLHAPDFBilinearInterpolator<ReaderType>::interpolate(double x, double mu2,
                                               std::array<double, DEFAULT_TOTAL_PDFS> &output) const
 {
-    const size_t ix = indexbelow(x, m_Shape.x_vec);
-    const size_t imu2 = indexbelow(mu2, m_Shape.mu2_vec);
-    shared_dataLinear shared = fill(m_Shape, x, mu2, ix);
+    const size_t ix = indexbelow(x, m_Shape->x_vec);
+    const size_t imu2 = indexbelow(mu2, m_Shape->mu2_vec);
+    shared_dataLinear shared = fill(*m_Shape, x, mu2, ix);
     for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
     {
-        output[i] = _interpolate(m_Shape, ix, imu2, standardPartonFlavors[i], shared);
+        output[i] = _interpolate(*m_Shape, ix, imu2, standardPartonFlavors[i], shared);
     }
 }
 template<class ReaderType>
 double CLHAPDFBilinearInterpolator<ReaderType>::interpolate(PartonFlavor flavor, double x, double mu2) const
 {
-    const size_t ix = indexbelow(x, m_Shape.x_vec);
-    const size_t imu2 = indexbelow(mu2, m_Shape.mu2_vec);
-    shared_dataLinear shared = fill(m_Shape, x, mu2, ix);
-    return _interpolate(m_Shape, ix, imu2, flavor, shared);
+    const size_t ix = indexbelow(x, m_Shape->x_vec);
+    const size_t imu2 = indexbelow(mu2, m_Shape->mu2_vec);
+    shared_dataLinear shared = fill(*m_Shape, x, mu2, ix);
+    return _interpolate(*m_Shape, ix, imu2, flavor, shared);
 }
 } // namespace PDFxTMD
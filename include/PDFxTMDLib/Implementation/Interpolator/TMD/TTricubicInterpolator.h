@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
+#include "PDFxTMDLib/Common/AllFlavorsShape.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TricubicKernels.h"
+#include "PDFxTMDLib/Interface/IInterpolator.h"
+#include "PDFxTMDLib/Interface/IReader.h"
+
+namespace PDFxTMD
+{
+/**
+ * @brief Tricubic Hermite interpolation in (log x, log kt2, log mu2) of a
+ * DefaultAllFlavorTMDShape.
+ *
+ * A drop-in alternative to TTrilinearInterpolator for both TMD readers, selected with
+ * "Interpolator: TTricubicInterpolator" in the info file. It reaches the accuracy of trilinear
+ * interpolation on much coarser grids, at the cost of a derivative table of 8 values per grid
+ * value, built when the member is loaded. Points outside the grid are clamped to the boundary
+ * cells.
+ */
+template <class ReaderType>
+class TTricubicInterpolator : public ITMDInterpolator<TTricubicInterpolator<ReaderType>, ReaderType>
+{
+  public:
+    explicit TTricubicInterpolator() = default;
+    void initialize(const IReader<ReaderType> *reader)
+    {
+        m_reader = reader;
+        const DefaultAllFlavorTMDShape &shape = reader->getData();
+        std::shared_ptr<const DefaultAllFlavorTMDShape> sourceGrid = reader->getSharedData();
+        // Copies and moves of a PDF keep the reader's shared grid, so the table still matches. A
+        // grid that was freed never matches, even if a new one reuses its address.
+        if (m_kernel && sourceGrid && m_sourceGrid.lock() == sourceGrid)
+            return;
+        auto kernel = std::make_shared<TricubicGrid>();
+        kernel->initialize(shape);
+        m_kernel = std::move(kernel);
+        m_tmdShape = &shape;
+        m_sourceGrid = sourceGrid;
+
+        int firstColumn = -1, lastColumn = -1;
+        for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+        {
+            m_columns[i] = shape.get_pid(standardPartonFlavors[i]);
+            if (m_columns[i] == -1)
+                continue;
+            if (firstColumn == -1 || m_columns[i] < firstColumn)
+                firstColumn = m_columns[i];
+            lastColumn = std::max(lastColumn, m_columns[i]);
+        }
+        m_firstColumn = firstColumn == -1 ? 0 : static_cast<size_t>(firstColumn);
+        m_nColumns = firstColumn == -1 ? 0 : static_cast<size_t>(lastColumn - firstColumn + 1);
+    }
+    double interpolate(PartonFlavor flavor, double x, double kt2, double mu2) const
+    {
+        const int flavorId = m_tmdShape->get_pid(flavor);
+        if (flavorId == -1)
+            return 0.0;
+        const TricubicCell cell = m_kernel->locate(std::log(x), std::log(kt2), std::log(mu2));
+        return toTMD(m_kernel->blend(cell, flavorId), kt2);
+    }
+    void interpolate(double x, double kt2, double mu2,
+                     std::array<double, DEFAULT_TOTAL_PDFS> &output) const
+    {
+        const TricubicCell cell = m_kernel->locate(std::log(x), std::log(kt2), std::log(mu2));
+        if (m_nColumns > MAX_BLEND_COLUMNS)
+        {
+            for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+                output[i] =
+                    m_columns[i] == -1 ? 0 : toTMD(m_kernel->blend(cell, m_columns[i]), kt2);
+            return;
+        }
+        std::array<double, MAX_BLEND_COLUMNS> values;
+        m_kernel->blend(cell, m_firstColumn, m_nColumns, values.data());
+        for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+            output[i] = m_columns[i] == -1 ? 0 : toTMD(values[m_columns[i] - m_firstColumn], kt2);
+    }
+    /// Evaluates @p flavor at the @p n points (x[i], kt2[i], mu2[i]) into @p output.
+    void interpolate(PartonFlavor flavor, const double *x, const double *kt2, const double *mu2,
+                     double *output, size_t n) const
+    {
+        const int flavorId = m_tmdShape->get_pid(flavor);
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (flavorId == -1)
+            {
+                output[i] = 0.0;
+                continue;
+            }
+            const TricubicCell cell =
+                m_kernel->locate(std::log(x[i]), std::log(kt2[i]), std::log(mu2[i]));
+            output[i] = toTMD(m_kernel->blend(cell, flavorId), kt2[i]);
+        }
+    }
+    const IReader<ReaderType> *getReader() const
+    {
+        return m_reader;
+    }
+    /// Values and derivatives at the knots, stored as [x][kt2][mu2][flavor][8]
+    const std::vector<double> &getCoefficients() const
+    {
+        return m_kernel->table();
+    }
+
+  private:
+    /// Widest range of grid columns blended on the stack by the all-flavor overload
+    static constexpr size_t MAX_BLEND_COLUMNS = 32;
+
+    static double toTMD(double value, double kt2)
+    {
+        return value < 0 ? 0 : value / kt2;
+    }
+
+    const IReader<ReaderType> *m_reader;
+    // Grid owned by the reader; the derivative table is shared by copies of the interpolator
+    const DefaultAllFlavorTMDShape *m_tmdShape = nullptr;
+    // Reader grid the table was derived from; expires with it
+    std::weak_ptr<const DefaultAllFlavorTMDShape> m_sourceGrid;
+    std::shared_ptr<const TricubicGrid> m_kernel;
+    /// Grid column of each standard flavor, or -1, and the range of columns they span
+    std::array<int, DEFAULT_TOTAL_PDFS> m_columns;
+    size_t m_firstColumn = 0;
+    size_t m_nColumns = 0;
+};
+
+} // namespace PDFxTMD
@@ -1,16 +1,28 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "PDFxTMDLib/Common/AllFlavorsShape.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TrilinearKernels.h"
 #include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultLHAPDF_TMDReader.h"
 #include "PDFxTMDLib/Interface/IInterpolator.h"
 #include "PDFxTMDLib/Interface/IReader.h"
-#include "PDFxTMDLib/external/mlinterp/mlinterp.hpp"
 
 namespace PDFxTMD
 {
+/**
+ * @brief Trilinear interpolation in (log x, log kt2, log mu2) of a DefaultAllFlavorTMDShape.
+ *
+ * The cell and the weights of its corners are found once per point and shared by all flavors,
+ * which are stored next to each other in the grid, so the all-flavor overload blends them in one
+ * vectorized pass. Points outside the grid are clamped to the boundary cells.
+ */
 template <class ReaderType>
 class TTrilinearInterpolator : public ITMDInterpolator<TTrilinearInterpolator<ReaderType>, ReaderType>
 {
@@ -19,41 +31,58 @@ class TTrilinearInterpolator : public ITMDInterpolator<TTrilinearInterpolator<Re
     void initialize(const IReader<ReaderType> *reader)
     {
         m_reader = reader;
-        m_tmdShape = reader->getData();
-        m_dimensions = {static_cast<int>(m_tmdShape.x_vec.size()),
-                        static_cast<int>(m_tmdShape.kt2_vec.size()),
-                        static_cast<int>(m_tmdShape.mu2_vec.size())};
+        const DefaultAllFlavorTMDShape &shape = reader->getData();
+        std::shared_ptr<const DefaultAllFlavorTMDShape> sourceGrid = reader->getSharedData();
+        // Copies of a PDF share the grid of the reader, and the kernel with it. A grid that was
+        // freed never matches, even if a new one reuses its address.
+        if (m_tmdShape && sourceGrid && m_sourceGrid.lock() == sourceGrid)
+            return;
+        m_tmdShape = &shape;
+        m_sourceGrid = sourceGrid;
+        m_kernel.initialize(shape);
+
+        int firstColumn = -1, lastColumn = -1;
+        for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+        {
+            m_columns[i] = shape.get_pid(standardPartonFlavors[i]);
+            if (m_columns[i] == -1)
+                continue;
+            if (firstColumn == -1 || m_columns[i] < firstColumn)
+                firstColumn = m_columns[i];
+            lastColumn = std::max(lastColumn, m_columns[i]);
+        }
+        m_firstColumn = firstColumn == -1 ? 0 : static_cast<size_t>(firstColumn);
+        m_nColumns = firstColumn == -1 ? 0 : static_cast<size_t>(lastColumn - firstColumn + 1);
     }
     double interpolate(PartonFlavor flavor, double x, double kt2, double mu2) const
     {
-        using namespace mlinterp;
-        double *selectedPdf = &m_tmdShape.grids[flavor][0];
-        double output[1];
-        double logX = std::log(x);
-        double logkt2 = std::log(kt2);
-        double logMu2 = std::log(mu2);
-        interp(m_dimensions.data(), 1, selectedPdf, output, m_tmdShape.log_x_vec.data(), &logX, m_tmdShape.log_kt2_vec.data(), &logkt2
-               , m_tmdShape.log_mu2_vec.data(), &logMu2);
-
-        return output[0] < 0 ? 0 : output[0] / kt2;
+        const int flavorId = m_tmdShape->get_pid(flavor);
+        if (flavorId == -1)
+            return 0.0;
+        return interpolateColumn(flavorId, x, kt2, mu2);
     }
     void interpolate(double x, double kt2, double mu2,
                      std::array<double, DEFAULT_TOTAL_PDFS> &output) const
     {
-        using namespace mlinterp;
-        double output_[1];
-        double logX = std::log(x);
-        double logkt2 = std::log(kt2);
-        double logMu2 = std::log(mu2);
-
-        for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+        const TrilinearCell cell = m_kernel.locate(std::log(x), std::log(kt2), std::log(mu2));
+        if (m_nColumns > MAX_BLEND_COLUMNS)
         {
-            double *selectedPdf = &m_tmdShape.grids[standardPartonFlavors[i]][0];
-            interp(m_dimensions.data(), 1, selectedPdf, output_, m_tmdShape.log_x_vec.data(), &logX,
-                   m_tmdShape.log_kt2_vec.data(), &logkt2, m_tmdShape.log_mu2_vec.data(), &logMu2);
-
-            output[i] = (output_[0] < 0 ? 0 : output_[0] / kt2);
+            for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+                output[i] = m_columns[i] == -1 ? 0 : toTMD(m_kernel.blend(cell, m_columns[i]), kt2);
+            return;
         }
+        std::array<double, MAX_BLEND_COLUMNS> values;
+        m_kernel.blend(cell, m_firstColumn, m_nColumns, values.data());
+        for (int i = 0; i < DEFAULT_TOTAL_PDFS; i++)
+            output[i] = m_columns[i] == -1 ? 0 : toTMD(values[m_columns[i] - m_firstColumn], kt2);
+    }
+    /// Evaluates @p flavor at the @p n points (x[i], kt2[i], mu2[i]) into @p output.
+    void interpolate(PartonFlavor flavor, const double *x, const double *kt2, const double *mu2,
+                     double *output, size_t n) const
+    {
+        const int flavorId = m_tmdShape->get_pid(flavor);
+        for (size_t i = 0; i < n; ++i)
+            output[i] = flavorId == -1 ? 0.0 : interpolateColumn(flavorId, x[i], kt2[i], mu2[i]);
     }
     const IReader<ReaderType> *getReader() const
     {
@@ -61,9 +90,29 @@ class TTrilinearInterpolator : public ITMDInterpolator<TTrilinearInterpolator<Re
     }
 
   private:
+    /// Widest range of grid columns blended on the stack by the all-flavor overload
+    static constexpr size_t MAX_BLEND_COLUMNS = 32;
+
+    static double toTMD(double value, double kt2)
+    {
+        return value < 0 ? 0 : value / kt2;
+    }
+    double interpolateColumn(int flavorId, double x, double kt2, double mu2) const
+    {
+        const TrilinearCell cell = m_kernel.locate(std::log(x), std::log(kt2), std::log(mu2));
+        return toTMD(m_kernel.blend(cell, flavorId), kt2);
+    }
+
     const IReader<ReaderType> *m_reader;
-    std::array<int, 3> m_dimensions;
-    mutable DefaultAllFlavorTMDShape m_tmdShape;
+    // Grid owned by the reader, used in place without a copy.
+    const DefaultAllFlavorTMDShape *m_tmdShape = nullptr;
+    // Reader grid the kernel was set up for; expires with it
+    std::weak_ptr<const DefaultAllFlavorTMDShape> m_sourceGrid;
+    TrilinearGrid m_kernel;
+    /// Grid column of each standard flavor, or -1, and the range of columns they span
+    std::array<int, DEFAULT_TOTAL_PDFS> m_columns;
+    size_t m_firstColumn = 0;
+    size_t m_nColumns = 0;
 };
 
 } // namespace PDFxTMD
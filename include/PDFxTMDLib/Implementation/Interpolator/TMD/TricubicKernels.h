@@ -0,0 +1,127 @@
+/// @file TricubicKernels.h
+/// @brief Tricubic Hermite interpolation kernel for TMD grids stored as [x][kt2][mu2][flavor].
+///
+/// When the grid is loaded, the derivatives of every grid value in log x, log kt2 and log mu2 and
+/// their mixed products are estimated with the finite differences LHAPDF uses for its bicubic
+/// interpolation. Evaluating a point then takes the 8 values stored at each of the 8 corners of
+/// its cell, weighted by products of one-dimensional cubic Hermite basis functions. The weights
+/// depend only on the point, so they are computed once and shared by all flavors.
+#pragma once
+#include "PDFxTMDLib/Common/AllFlavorsShape.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TrilinearKernels.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace PDFxTMD
+{
+/// Offsets of the corners of a cell into the coefficient table, and the weight of each of their
+/// 8 values
+struct TricubicCell
+{
+    std::array<size_t, 8> offsets;
+    std::array<double, 64> weights;
+};
+
+/**
+ * @brief Tricubic Hermite interpolation in (log x, log kt2, log mu2) of a
+ * DefaultAllFlavorTMDShape.
+ *
+ * The interpolant matches the grid values at the knots and is continuous with its first
+ * derivatives. The precomputed table holds 8 values per grid value, the value followed by its
+ * derivatives d/dlogx, d/dlogkt2, d2/dlogx dlogkt2, d/dlogmu2, and so on, as bits of the slot
+ * index. The knots are used in place, so the grid must outlive the kernel.
+ */
+class TricubicGrid
+{
+  public:
+    /// Builds the derivative table. Every axis needs at least two knots.
+    void initialize(const DefaultAllFlavorTMDShape &shape);
+
+    /// Cell of the point (logX, logKt2, logMu2), clamped to the grid
+    TricubicCell locate(double logX, double logKt2, double logMu2) const
+    {
+        const std::array<double, 3> values = {logX, logKt2, logMu2};
+        // Hermite basis per axis, [corner][0] weighting the value at the lower or upper knot and
+        // [corner][1] its derivative
+        std::array<std::array<std::array<double, 2>, 2>, 3> basis;
+        size_t offset = 0;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            size_t index;
+            double weight;
+            m_axes[axis].locate(values[axis], index, weight);
+            const double t = 1 - weight;
+            const double t2 = t * t;
+            const double t3 = t2 * t;
+            const double width = (*m_knots[axis])[index + 1] - (*m_knots[axis])[index];
+            basis[axis][0] = {2 * t3 - 3 * t2 + 1, (t3 - 2 * t2 + t) * width};
+            basis[axis][1] = {-2 * t3 + 3 * t2, (t3 - t2) * width};
+            offset += index * m_strides[axis];
+        }
+
+        // Corner cx | ckt << 1 | cmu << 2, slot dx | dkt << 1 | dmu << 2
+        TricubicCell cell;
+        for (int cmu = 0; cmu < 2; cmu++)
+            for (int ckt = 0; ckt < 2; ckt++)
+                for (int cx = 0; cx < 2; cx++)
+                    cell.offsets[cx | ckt << 1 | cmu << 2] =
+                        offset + cx * m_strides[0] + ckt * m_strides[1] + cmu * m_strides[2];
+        for (int cmu = 0; cmu < 2; cmu++)
+            for (int dmu = 0; dmu < 2; dmu++)
+                for (int ckt = 0; ckt < 2; ckt++)
+                    for (int dkt = 0; dkt < 2; dkt++)
+                    {
+                        const double muKt = basis[2][cmu][dmu] * basis[1][ckt][dkt];
+                        for (int cx = 0; cx < 2; cx++)
+                            for (int dx = 0; dx < 2; dx++)
+                                cell.weights[(cx | ckt << 1 | cmu << 2) * 8 +
+                                             (dx | dkt << 1 | dmu << 2)] =
+                                    muKt * basis[0][cx][dx];
+                    }
+        return cell;
+    }
+
+    /// Interpolated value of grid column @p flavorId
+    double blend(const TricubicCell &cell, int flavorId) const
+    {
+        const double *table = m_table.data() + static_cast<size_t>(flavorId) * 8;
+        // One running sum per slot, so the slots of a corner are blended in SIMD lanes
+        std::array<double, 8> sums = {0, 0, 0, 0, 0, 0, 0, 0};
+        for (int corner = 0; corner < 8; corner++)
+        {
+            const double *values = table + cell.offsets[corner];
+            const double *weights = cell.weights.data() + corner * 8;
+            for (int slot = 0; slot < 8; slot++)
+                sums[slot] += weights[slot] * values[slot];
+        }
+        return ((sums[0] + sums[4]) + (sums[1] + sums[5])) +
+               ((sums[2] + sums[6]) + (sums[3] + sums[7]));
+    }
+
+    /// Interpolated values of the grid columns [firstColumn, firstColumn + nColumns) into
+    /// @p output, reading each corner once
+    void blend(const TricubicCell &cell, size_t firstColumn, size_t nColumns,
+               double *output) const;
+
+    /// Values and derivatives as [x][kt2][mu2][flavor][slot]
+    const std::vector<double> &table() const
+    {
+        return m_table;
+    }
+
+    /// Heap memory held by the derivative table, in bytes
+    size_t memoryUsage() const
+    {
+        return m_table.capacity() * sizeof(double);
+    }
+
+  private:
+    std::array<TrilinearAxis, 3> m_axes;
+    std::array<const std::vector<double> *, 3> m_knots = {nullptr, nullptr, nullptr};
+    /// Knot strides of the table along x, kt2 and mu2
+    std::array<size_t, 3> m_strides = {0, 0, 0};
+    /// Values and derivatives as [x][kt2][mu2][flavor][slot]
+    std::vector<double> m_table;
+};
+} // namespace PDFxTMD
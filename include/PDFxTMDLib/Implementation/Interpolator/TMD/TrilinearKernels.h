@@ -0,0 +1,140 @@
+/// @file TrilinearKernels.h
+/// @brief Trilinear interpolation kernel for TMD grids stored as [x][kt2][mu2][flavor].
+///
+/// A point is located once per axis and turned into a TrilinearCell, the offsets and weights of
+/// the grid corners around it, which is then blended for one flavor or for a contiguous range of
+/// flavors at once. The range blend is vectorized over the flavors with AVX-512 or AVX2, selected
+/// at compile time from the target flags, with a scalar fallback for other targets.
+#pragma once
+#include "PDFxTMDLib/Common/AllFlavorsShape.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace PDFxTMD
+{
+/**
+ * @brief Interval lookup on the sorted log knots of one grid axis.
+ *
+ * A table of uniform buckets over the knot range gives the interval of a point in O(1), up to a
+ * step or two of linear search; for knots that are uniform in log there is nothing to search.
+ */
+class TrilinearAxis
+{
+  public:
+    /// Builds the bucket table for @p knots, which must outlive the axis.
+    void initialize(const std::vector<double> &knots);
+
+    /// Lower knot of the cell holding @p value, and the weight of that knot. Values outside the
+    /// knots are clamped to the boundary cells.
+    void locate(double value, size_t &index, double &weight) const
+    {
+        if (m_size == 1 || !(value > m_knots[0]))
+        {
+            index = 0;
+            weight = 1.;
+            return;
+        }
+        if (value >= m_knots[m_size - 1])
+        {
+            index = m_size - 2;
+            weight = 0.;
+            return;
+        }
+        const size_t bucket = static_cast<size_t>((value - m_knots[0]) * m_invBucketWidth);
+        size_t i = m_bucketIndex[std::min(bucket, m_bucketIndex.size() - 1)];
+        while (m_knots[i + 1] <= value)
+            ++i;
+        while (i > 0 && m_knots[i] > value)
+            --i;
+        index = i;
+        weight = (m_knots[i + 1] - value) / (m_knots[i + 1] - m_knots[i]);
+    }
+
+  private:
+    const double *m_knots = nullptr;
+    size_t m_size = 0;
+    double m_invBucketWidth = 0;
+    /// Last interval starting at or below each bucket edge
+    std::vector<unsigned> m_bucketIndex;
+};
+
+/// Offsets into grids_flat and weights of the corners that contribute to a point
+struct TrilinearCell
+{
+    std::array<size_t, 8> offsets;
+    std::array<double, 8> weights;
+    int size = 0;
+};
+
+/**
+ * @brief Trilinear interpolation in (log x, log kt2, log mu2) of a DefaultAllFlavorTMDShape.
+ *
+ * The grid is used in place; it must outlive the kernel, and initialize has to be called again if
+ * it moves.
+ */
+class TrilinearGrid
+{
+  public:
+    void initialize(const DefaultAllFlavorTMDShape &shape);
+
+    /// Cell of the point (logX, logKt2, logMu2), clamped to the grid
+    TrilinearCell locate(double logX, double logKt2, double logMu2) const
+    {
+        std::array<size_t, 3> indices;
+        std::array<double, 3> weights;
+        m_axes[0].locate(logX, indices[0], weights[0]);
+        m_axes[1].locate(logKt2, indices[1], weights[1]);
+        m_axes[2].locate(logMu2, indices[2], weights[2]);
+
+        TrilinearCell cell;
+        for (int corner = 0; corner < 8; corner++)
+        {
+            double factor = 1.;
+            size_t offset = 0;
+            for (int axis = 0; axis < 3; axis++)
+            {
+                if (corner & (1 << axis))
+                {
+                    offset += indices[axis] * m_strides[axis];
+                    factor *= weights[axis];
+                }
+                else
+                {
+                    offset += (indices[axis] + 1) * m_strides[axis];
+                    factor *= 1 - weights[axis];
+                }
+            }
+            // Corners without weight may lie outside an axis with a single knot
+            if (factor > std::numeric_limits<double>::epsilon())
+            {
+                cell.offsets[cell.size] = offset;
+                cell.weights[cell.size] = factor;
+                cell.size++;
+            }
+        }
+        return cell;
+    }
+
+    /// Interpolated value of grid column @p flavorId
+    double blend(const TrilinearCell &cell, int flavorId) const
+    {
+        const double *grid = m_grid + flavorId;
+        double value = 0.;
+        for (int corner = 0; corner < cell.size; corner++)
+            value += cell.weights[corner] * grid[cell.offsets[corner]];
+        return value;
+    }
+
+    /// Interpolated values of the grid columns [firstColumn, firstColumn + nColumns) into @p output
+    void blend(const TrilinearCell &cell, size_t firstColumn, size_t nColumns,
+               double *output) const;
+
+  private:
+    std::array<TrilinearAxis, 3> m_axes;
+    std::array<size_t, 3> m_strides = {0, 0, 0};
+    const double *m_grid = nullptr;
+};
+} // namespace PDFxTMD
@@ -2,6 +2,7 @@
 #include "PDFxTMDLib/Common/AllFlavorsShape.h"
 #include "PDFxTMDLib/Common/NumParser.h"
 #include "PDFxTMDLib/Interface/IReader.h"
+#include <memory>
 
 namespace PDFxTMD
 {
@@ -10,13 +11,16 @@ class CDefaultLHAPDFFileReader : public IReader<CDefaultLHAPDFFileReader>
 {
   public:
     void read(const std::string &pdfName, int setNumber);
-    DefaultAllFlavorShape getData() const;
-    std::vector<double> getValues(PhaseSpaceComponent comp) const;
+    const DefaultAllFlavorShape &getData() const;
+    /// The grid of getData() itself, for owners of data derived from it
+    std::shared_ptr<const DefaultAllFlavorShape> getSharedData() const;
+    const std::vector<double> &getValues(PhaseSpaceComponent comp) const;
     std::pair<double, double> getBoundaryValues(PhaseSpaceComponent comp) const;
 
   private:
     std::vector<DefaultAllFlavorShape> m_pdfShape;
-    DefaultAllFlavorShape m_pdfShape_flat;
+    // Parsed grid, shared through GridCache with other readers of the same file
+    std::shared_ptr<const DefaultAllFlavorShape> m_pdfShape_flat;
     std::vector<double> m_mu2CompTotal;
     int m_blockNumber = 0;
     int m_blockLine = 0;
@@ -24,6 +28,8 @@ class CDefaultLHAPDFFileReader : public IReader<CDefaultLHAPDFFileReader>
     std::pair<double, double> m_q2MinMax;
 
   private:
+    std::shared_ptr<DefaultAllFlavorShape> parse(const std::string &pdfName,
+                                                 const std::string &filePath);
     void processDataLine(const std::string &line, DefaultAllFlavorShape &data);
     void readXKnots(NumParser &parser, DefaultAllFlavorShape &data);
     void readQ2Knots(NumParser &parser, DefaultAllFlavorShape &data);
@@ -4,6 +4,7 @@
 #include "PDFxTMDLib/Common/AllFlavorsShape.h"
 #include "PDFxTMDLib/Common/Exception.h"
 #include "PDFxTMDLib/Interface/IReader.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -13,11 +14,18 @@ class TDefaultAllFlavorReader : public IReader<TDefaultAllFlavorReader>
 {
   public:
     void read(const std::string &pdfName, int setNumber);
-    DefaultAllFlavorTMDShape getData() const;
+    const DefaultAllFlavorTMDShape &getData() const;
+    /// The grid of getData() itself, for owners of data derived from it
+    std::shared_ptr<const DefaultAllFlavorTMDShape> getSharedData() const;
+    const std::vector<double> &getValues(PhaseSpaceComponent comp) const;
     std::pair<double, double> getBoundaryValues(PhaseSpaceComponent comp) const;
 
   private:
-    DefaultAllFlavorTMDShape m_updfShape;
+    std::shared_ptr<DefaultAllFlavorTMDShape> parse(const std::string &pdfName,
+                                                    const std::string &filePath);
+
+    // Parsed grid, shared through GridCache with other readers of the same file
+    std::shared_ptr<const DefaultAllFlavorTMDShape> m_updfShape;
     std::pair<double, double> m_xMinMax;
     std::pair<double, double> m_q2MinMax;
     std::pair<double, double> m_kt2MinMax;
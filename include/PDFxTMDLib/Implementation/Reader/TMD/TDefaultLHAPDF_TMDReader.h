@@ -2,6 +2,7 @@
 #include "PDFxTMDLib/Common/AllFlavorsShape.h"
 #include "PDFxTMDLib/Common/NumParser.h"
 #include "PDFxTMDLib/Interface/IReader.h"
+#include <memory>
 
 namespace PDFxTMD
 {
@@ -10,12 +11,15 @@ class TDefaultLHAPDF_TMDReader : public IReader<TDefaultLHAPDF_TMDReader>
 {
   public:
     void read(const std::string &pdfName, int setNumber);
-    DefaultAllFlavorTMDShape getData() const;
-    std::vector<double> getValues(PhaseSpaceComponent comp) const;
+    const DefaultAllFlavorTMDShape &getData() const;
+    /// The grid of getData() itself, for owners of data derived from it
+    std::shared_ptr<const DefaultAllFlavorTMDShape> getSharedData() const;
+    const std::vector<double> &getValues(PhaseSpaceComponent comp) const;
     std::pair<double, double> getBoundaryValues(PhaseSpaceComponent comp) const;
 
   private:
-    DefaultAllFlavorTMDShape m_pdfShape;
+    // Parsed grid, shared through GridCache with other readers of the same file
+    std::shared_ptr<const DefaultAllFlavorTMDShape> m_pdfShape;
     int m_blockNumber = 0;
     int m_blockLine = 0;
     std::pair<double, double> m_xMinMax;
@@ -23,6 +27,8 @@ class TDefaultLHAPDF_TMDReader : public IReader<TDefaultLHAPDF_TMDReader>
     std::pair<double, double> m_kt2MinMax;
 
   private:
+    std::shared_ptr<DefaultAllFlavorTMDShape> parse(const std::string &pdfName,
+                                                    const std::string &filePath);
     void processDataLine(const std::string &line, DefaultAllFlavorTMDShape &data);
     void readXKnots(NumParser &parser, DefaultAllFlavorTMDShape &data);
     void readKt2Knots(NumParser &parser, DefaultAllFlavorTMDShape &data);
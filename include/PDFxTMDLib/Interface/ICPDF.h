@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <memory>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 namespace PDFxTMD
@@ -44,7 +45,8 @@ class ICPDF
               using Model = OwningModel<CPDFApproachT>;
               auto *const model = static_cast<Model *>(pdfApproachBytes);
               return new Model(*model);
-          })
+          }),
+          type_([]() -> const std::type_info & { return typeid(CPDFApproachT); })
     {
     }
 
@@ -78,6 +80,32 @@ class ICPDF
     {
         pdfOperation1_(pimpl_.get(), x, mu2, output);
     }
+    /**
+     * @brief The type of the wrapped implementation, typically a GenericPDF instantiation, or
+     * `typeid(void)` for an object that has been moved from.
+     */
+    const std::type_info &targetType() const
+    {
+        return (pimpl_ && type_) ? type_() : typeid(void);
+    }
+    /**
+     * @brief Access the wrapped implementation with its concrete type.
+     *
+     * Calls through the returned pointer are direct, so the interpolation can be inlined into the
+     * caller's loop. See withConcrete in ConcretePDF.h for dispatching over the known types.
+     *
+     * @return The wrapped object, or nullptr if it is not a CPDFApproachT.
+     */
+    template <typename CPDFApproachT> CPDFApproachT *target()
+    {
+        if (targetType() != typeid(CPDFApproachT))
+            return nullptr;
+        return &static_cast<OwningModel<CPDFApproachT> *>(pimpl_.get())->pdfApproach_;
+    }
+    template <typename CPDFApproachT> const CPDFApproachT *target() const
+    {
+        return const_cast<ICPDF *>(this)->target<CPDFApproachT>();
+    }
     /**
      * @brief Copy constructor for ICPDF objects.
      *
@@ -88,7 +116,7 @@ class ICPDF
     ICPDF(const ICPDF &other)
         : pimpl_(other.clone_(other.pimpl_.get()), other.pimpl_.get_deleter()),
           clone_(other.clone_), pdfOperation_(other.pdfOperation_),
-          pdfOperation1_(other.pdfOperation1_)
+          pdfOperation1_(other.pdfOperation1_), type_(other.type_)
 
     {
     }
@@ -109,6 +137,7 @@ class ICPDF
         swap(clone_, copy.clone_);
         swap(pdfOperation_, copy.pdfOperation_);
         swap(pdfOperation1_, copy.pdfOperation1_);
+        swap(type_, copy.type_);
         return *this;
     }
 
@@ -138,10 +167,12 @@ class ICPDF
     using CloneOperation = void *(void *);
     using CPDFOperation = double(void *, PartonFlavor, double, double);
     using CPDFOperation1 = void(void *, double, double, std::array<double, 13> &);
+    using TypeOperation = const std::type_info &();
 
     std::unique_ptr<void, DestroyOperation *> pimpl_;
     CloneOperation *clone_{nullptr};
     CPDFOperation *pdfOperation_{nullptr};
     CPDFOperation1 *pdfOperation1_{nullptr};
+    TypeOperation *type_{nullptr};
 };
 } // namespace PDFxTMD
@@ -2,6 +2,10 @@
 #include "PDFxTMDLib/Common/InterfaceUtils.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
 #include "PDFxTMDLib/Interface/IReader.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace PDFxTMD
 {
@@ -32,6 +36,21 @@ class IcPDFInterpolator : public IInterpolator<Derived, Reader, X_T, MU_T>
 {
 };
 
+/// @brief Detects TMD interpolators providing the batch overload `interpolate(PartonFlavor, const
+/// double *x, const double *kt2, const double *mu2, double *output, size_t n)`. Interpolators
+/// without it are evaluated point by point.
+template <typename T, typename = void> struct HasBatchTMDInterpolate : std::false_type
+{
+};
+template <typename T>
+struct HasBatchTMDInterpolate<
+    T, std::void_t<decltype(std::declval<const T &>().interpolate(
+           std::declval<PartonFlavor>(), std::declval<const double *>(),
+           std::declval<const double *>(), std::declval<const double *>(),
+           std::declval<double *>(), size_t{}))>> : std::true_type
+{
+};
+
 template <typename Reader, typename Derived>
 class ITMDInterpolator : public IInterpolator<Derived, Reader, X_T, KT_T, MU_T>
 {
@@ -1,4 +1,5 @@
 #pragma once
+#include "PDFxTMDLib/Common/Instrumentation.h"
 #include <array>
 #include <cstddef>
 #include <cstdlib>
@@ -8,6 +9,18 @@
 // AlphaQCDMu2
 namespace PDFxTMD
 {
+/// @brief Detects couplings providing the batch overload `AlphaQCDMu2(const double *, double *,
+/// size_t)`. Couplings without it are evaluated point by point.
+template <typename T, typename = void> struct HasBatchAlphaQCDMu2 : std::false_type
+{
+};
+template <typename T>
+struct HasBatchAlphaQCDMu2<
+    T, std::void_t<decltype(std::declval<T &>().AlphaQCDMu2(
+           std::declval<const double *>(), std::declval<double *>(), size_t{}))>> : std::true_type
+{
+};
+
 // Interface for QCD Coupling
 class IQCDCoupling
 {
@@ -20,27 +33,47 @@ class IQCDCoupling
                      auto *const model = static_cast<Model *>(alphaQCDApproachBytes);
                      delete model;
                  }),
-          alphaQCOperation_([](void *alphaQCDApproachBytes, double mu2) -> double {
+          clone_([](void *alphaQCDApproachBytes) -> void * {
               using Model = OwningModel<AlphaQCOperation_T>;
               auto *const model = static_cast<Model *>(alphaQCDApproachBytes);
-              return model->AlphaQCDMu2(mu2); // fixed the pdf method call
+              return new Model(*model);
           }),
-          clone_([](void *alphaQCDApproachBytes) -> void * {
+          alphaQCOperation_([](void *alphaQCDApproachBytes, double mu2) -> double {
               using Model = OwningModel<AlphaQCOperation_T>;
               auto *const model = static_cast<Model *>(alphaQCDApproachBytes);
-              return new Model(*model);
-          })
+              return model->AlphaQCDMu2(mu2); // fixed the pdf method call
+          }),
+          alphaQCBatchOperation_(
+              [](void *alphaQCDApproachBytes, const double *mu2, double *alphas, size_t n) {
+                  using Model = OwningModel<AlphaQCOperation_T>;
+                  auto *const model = static_cast<Model *>(alphaQCDApproachBytes);
+                  model->AlphaQCDMu2(mu2, alphas, n);
+              })
     {
     }
 
     double AlphaQCDMu2(double mu2) const
     {
+        PDFXTMD_INSTRUMENT_GLOBAL(AlphaS, 1);
         return alphaQCOperation_(pimpl_.get(), mu2);
     }
 
+    /**
+     * @brief Evaluates alpha_s at a batch of scales.
+     * @param mu2 The n squared scales.
+     * @param alphas Output, the n couplings.
+     * @param n Number of points.
+     */
+    void AlphaQCDMu2(const double *mu2, double *alphas, size_t n) const
+    {
+        PDFXTMD_INSTRUMENT_GLOBAL(AlphaS, n);
+        alphaQCBatchOperation_(pimpl_.get(), mu2, alphas, n);
+    }
+
     IQCDCoupling(const IQCDCoupling &other)
         : pimpl_(other.clone_(other.pimpl_.get()), other.pimpl_.get_deleter()),
-          clone_(other.clone_), alphaQCOperation_(other.alphaQCOperation_)
+          clone_(other.clone_), alphaQCOperation_(other.alphaQCOperation_),
+          alphaQCBatchOperation_(other.alphaQCBatchOperation_)
     {
     }
 
@@ -51,6 +84,7 @@ class IQCDCoupling
         swap(pimpl_, copy.pimpl_);
         swap(clone_, copy.clone_);
         swap(alphaQCOperation_, copy.alphaQCOperation_);
+        swap(alphaQCBatchOperation_, copy.alphaQCBatchOperation_);
         return *this;
     }
 
@@ -70,15 +104,30 @@ class IQCDCoupling
             return alphaQCO_.AlphaQCDMu2(mu2); // fixed the pdf method signature
         }
 
+        void AlphaQCDMu2(const double *mu2, double *alphas, size_t n)
+        {
+            if constexpr (HasBatchAlphaQCDMu2<AlphaQCOperation_T>::value)
+            {
+                alphaQCO_.AlphaQCDMu2(mu2, alphas, n);
+            }
+            else
+            {
+                for (size_t i = 0; i < n; ++i)
+                    alphas[i] = alphaQCO_.AlphaQCDMu2(mu2[i]);
+            }
+        }
+
         AlphaQCOperation_T alphaQCO_;
     };
 
     using DestroyOperation = void(void *);
     using CloneOperation = void *(void *);
     using AlphaQCDOperation = double(void *, double);
+    using AlphaQCDBatchOperation = void(void *, const double *, double *, size_t);
 
     std::unique_ptr<void, DestroyOperation *> pimpl_;
     CloneOperation *clone_{nullptr};
     AlphaQCDOperation *alphaQCOperation_{nullptr};
+    AlphaQCDBatchOperation *alphaQCBatchOperation_{nullptr};
 };
 } // namespace PDFxTMD
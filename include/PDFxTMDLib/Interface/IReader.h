@@ -1,5 +1,8 @@
 #pragma once
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "PDFxTMDLib/Common/InterfaceUtils.h"
@@ -7,6 +10,15 @@
 
 namespace PDFxTMD
 {
+template <typename T, typename = void> struct HasSharedData : std::false_type
+{
+};
+template <typename T>
+struct HasSharedData<T, std::void_t<decltype(std::declval<const T &>().getSharedData())>>
+    : std::true_type
+{
+};
+
 template <typename Derived> class IReader : public CRTPBase<Derived>
 {
   public:
@@ -15,12 +27,25 @@ template <typename Derived> class IReader : public CRTPBase<Derived>
         this->derived().read(pdfName, setNumber);
     }
 
-    auto getData() const
+    /// Grid owned by the reader; valid until the next read().
+    const auto &getData() const
     {
         return this->derived().getData();
     }
 
-    std::vector<double> getValues(PhaseSpaceComponent comp) const
+    /// Grid shared by the readers of the same member, or null for a reader that does not share
+    /// its grid. Interpolators key the data they derive from the grid on it.
+    auto getSharedData() const
+    {
+        using Grid = std::decay_t<decltype(this->derived().getData())>;
+        if constexpr (HasSharedData<Derived>::value)
+            return std::shared_ptr<const Grid>(this->derived().getSharedData());
+        else
+            return std::shared_ptr<const Grid>();
+    }
+
+    /// Knot values owned by the reader; valid until the next read().
+    const std::vector<double> &getValues(PhaseSpaceComponent comp) const
     {
         return this->derived().getValues(comp);
     }
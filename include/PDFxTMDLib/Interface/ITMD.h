@@ -5,11 +5,34 @@
 #include <cstdlib>
 #include <memory>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
 namespace PDFxTMD
 {
+/// @brief Detects TMD implementations providing the batch overloads `tmd(PartonFlavor, const
+/// double *x, const double *kt2, const double *mu2, double *output, size_t n)` and `tmd(const
+/// double *x, const double *kt2, const double *mu2, std::array<double, 13> *output, size_t n)`.
+/// Implementations without them are evaluated point by point.
+template <typename T, typename = void> struct HasBatchTMD : std::false_type
+{
+};
+template <typename T>
+struct HasBatchTMD<T, std::void_t<decltype(std::declval<T &>().tmd(
+                                      std::declval<PartonFlavor>(), std::declval<const double *>(),
+                                      std::declval<const double *>(),
+                                      std::declval<const double *>(), std::declval<double *>(),
+                                      size_t{})),
+                                  decltype(std::declval<T &>().tmd(
+                                      std::declval<const double *>(),
+                                      std::declval<const double *>(),
+                                      std::declval<const double *>(),
+                                      std::declval<std::array<double, DEFAULT_TOTAL_PDFS> *>(),
+                                      size_t{}))>> : std::true_type
+{
+};
+
 /**
  * @brief Interface for Transverse Momentum Dependent (TMD) parton distribution functions.
  *
@@ -18,6 +41,8 @@ namespace PDFxTMD
  * The class handles:
  * - Single flavor TMD evaluation with tmd(flavor, x, kt2, mu2)
  * - All flavors TMD evaluation with tmd(x, kt2, mu2, tmds)
+ * - Both of them at many points with tmd(flavor, x, kt2, mu2, output, n) and
+ *   tmd(x, kt2, mu2, output, n)
  */
 class ITMD
 {
@@ -30,6 +55,11 @@ class ITMD
                      auto *const model = static_cast<Model *>(tmdfApproachBytes);
                      delete model;
                  }),
+          clone_([](void *tmdfApproachBytes) -> void * {
+              using Model = OwningModel<TMDApproachT>;
+              auto *const model = static_cast<Model *>(tmdfApproachBytes);
+              return new Model(*model);
+          }),
           tmdOperation_([](void *tmdfApproachBytes, PartonFlavor flavor, double x, double kt2,
                            double mu2) -> double {
               using Model = OwningModel<TMDApproachT>;
@@ -42,11 +72,22 @@ class ITMD
               auto *const model = static_cast<Model *>(tmdfApproachBytes);
               model->tmd(x, kt2, mu2, output);
           }),
-          clone_([](void *tmdfApproachBytes) -> void * {
+          tmdBatchOperation_([](void *tmdfApproachBytes, PartonFlavor flavor, const double *x,
+                                const double *kt2, const double *mu2, double *output,
+                                size_t n) -> void {
               using Model = OwningModel<TMDApproachT>;
               auto *const model = static_cast<Model *>(tmdfApproachBytes);
-              return new Model(*model);
-          })
+              model->tmd(flavor, x, kt2, mu2, output, n);
+          }),
+          tmdBatchOperation1_([](void *tmdfApproachBytes, const double *x, const double *kt2,
+                                 const double *mu2,
+                                 std::array<double, DEFAULT_TOTAL_PDFS> *output,
+                                 size_t n) -> void {
+              using Model = OwningModel<TMDApproachT>;
+              auto *const model = static_cast<Model *>(tmdfApproachBytes);
+              model->tmd(x, kt2, mu2, output, n);
+          }),
+          type_([]() -> const std::type_info & { return typeid(TMDApproachT); })
     {
     }
 
@@ -82,6 +123,58 @@ class ITMD
         return tmdOperation1_(pimpl_.get(), x, kt2, mu2, output);
     }
 
+    /**
+     * @brief Evaluate the TMD PDF for a specific flavor at many points.
+     *
+     * Equivalent to output[i] = tmd(flavor, x[i], kt2[i], mu2[i]) for i < n, with a single
+     * indirect call for the whole batch.
+     */
+    void tmd(PartonFlavor flavor, const double *x, const double *kt2, const double *mu2,
+             double *output, size_t n) const
+    {
+        tmdBatchOperation_(pimpl_.get(), flavor, x, kt2, mu2, output, n);
+    }
+
+    /**
+     * @brief Evaluate the TMD PDF for all flavors at many points.
+     *
+     * Equivalent to tmd(x[i], kt2[i], mu2[i], output[i]) for i < n, with a single indirect call
+     * for the whole batch.
+     */
+    void tmd(const double *x, const double *kt2, const double *mu2,
+             std::array<double, DEFAULT_TOTAL_PDFS> *output, size_t n) const
+    {
+        tmdBatchOperation1_(pimpl_.get(), x, kt2, mu2, output, n);
+    }
+
+    /**
+     * @brief The type of the wrapped implementation, typically a GenericPDF instantiation, or
+     * `typeid(void)` for an object that has been moved from.
+     */
+    const std::type_info &targetType() const
+    {
+        return (pimpl_ && type_) ? type_() : typeid(void);
+    }
+
+    /**
+     * @brief Access the wrapped implementation with its concrete type.
+     *
+     * Calls through the returned pointer are direct, so the interpolation can be inlined into the
+     * caller's loop. See withConcrete in ConcretePDF.h for dispatching over the known types.
+     *
+     * @return The wrapped object, or nullptr if it is not a TMDApproachT.
+     */
+    template <typename TMDApproachT> TMDApproachT *target()
+    {
+        if (targetType() != typeid(TMDApproachT))
+            return nullptr;
+        return &static_cast<OwningModel<TMDApproachT> *>(pimpl_.get())->m_tmdApproach;
+    }
+    template <typename TMDApproachT> const TMDApproachT *target() const
+    {
+        return const_cast<ITMD *>(this)->target<TMDApproachT>();
+    }
+
     /**
      * @brief Copy constructor for ITMD objects.
      *
@@ -92,7 +185,8 @@ class ITMD
     ITMD(const ITMD &other)
         : pimpl_(other.clone_(other.pimpl_.get()), other.pimpl_.get_deleter()),
           clone_(other.clone_), tmdOperation_(other.tmdOperation_),
-          tmdOperation1_(other.tmdOperation1_)
+          tmdOperation1_(other.tmdOperation1_), tmdBatchOperation_(other.tmdBatchOperation_),
+          tmdBatchOperation1_(other.tmdBatchOperation1_), type_(other.type_)
     {
     }
 
@@ -112,6 +206,9 @@ class ITMD
         swap(clone_, copy.clone_);
         swap(tmdOperation_, copy.tmdOperation_);
         swap(tmdOperation1_, copy.tmdOperation1_);
+        swap(tmdBatchOperation_, copy.tmdBatchOperation_);
+        swap(tmdBatchOperation1_, copy.tmdBatchOperation1_);
+        swap(type_, copy.type_);
         return *this;
     }
 
@@ -156,6 +253,32 @@ class ITMD
         {
             return m_tmdApproach.tmd(x, kt2, mu2, output);
         }
+        void tmd(PartonFlavor flavor, const double *x, const double *kt2, const double *mu2,
+                 double *output, size_t n)
+        {
+            if constexpr (HasBatchTMD<TMDApproachT>::value)
+            {
+                m_tmdApproach.tmd(flavor, x, kt2, mu2, output, n);
+            }
+            else
+            {
+                for (size_t i = 0; i < n; ++i)
+                    output[i] = m_tmdApproach.tmd(flavor, x[i], kt2[i], mu2[i]);
+            }
+        }
+        void tmd(const double *x, const double *kt2, const double *mu2,
+                 std::array<double, DEFAULT_TOTAL_PDFS> *output, size_t n)
+        {
+            if constexpr (HasBatchTMD<TMDApproachT>::value)
+            {
+                m_tmdApproach.tmd(x, kt2, mu2, output, n);
+            }
+            else
+            {
+                for (size_t i = 0; i < n; ++i)
+                    m_tmdApproach.tmd(x[i], kt2[i], mu2[i], output[i]);
+            }
+        }
         TMDApproachT m_tmdApproach;
     };
 
@@ -164,10 +287,18 @@ class ITMD
     using TMDOperation = double(void *, PartonFlavor, double, double, double);
     using TMDOperation1 = void(void *, double, double, double,
                                std::array<double, DEFAULT_TOTAL_PDFS> &output);
+    using TMDBatchOperation = void(void *, PartonFlavor, const double *, const double *,
+                                   const double *, double *, size_t);
+    using TMDBatchOperation1 = void(void *, const double *, const double *, const double *,
+                                    std::array<double, DEFAULT_TOTAL_PDFS> *, size_t);
+    using TypeOperation = const std::type_info &();
 
     std::unique_ptr<void, DestroyOperation *> pimpl_;
     CloneOperation *clone_{nullptr};
     TMDOperation *tmdOperation_{nullptr};
     TMDOperation1 *tmdOperation1_{nullptr};
+    TMDBatchOperation *tmdBatchOperation_{nullptr};
+    TMDBatchOperation1 *tmdBatchOperation1_{nullptr};
+    TypeOperation *type_{nullptr};
 };
 } // namespace PDFxTMD
@@ -1,10 +1,31 @@
 #pragma once
 #include <PDFxTMDLib/Common/Uncertainty.h>
 #include <PDFxTMDLib/Common/YamlMetaInfo/YamlErrorInfo.h>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace PDFxTMD
 {
+/// @brief Detects strategies providing the block overloads of `Uncertainty`/`Correlation`
+/// (values laid out as points x members). Strategies without them are evaluated row by row.
+template <typename T, typename = void> struct HasBlockUncertainty : std::false_type
+{
+};
+template <typename T>
+struct HasBlockUncertainty<
+    T, std::void_t<decltype(std::declval<T &>().Uncertainty(
+                       std::declval<const std::vector<double> &>(), size_t{}, int{}, double{},
+                       std::declval<std::vector<PDFUncertainty> &>())),
+                   decltype(std::declval<T &>().Correlation(
+                       std::declval<const std::vector<double> &>(),
+                       std::declval<const std::vector<double> &>(), size_t{}, int{},
+                       std::declval<std::vector<double> &>()))>> : std::true_type
+{
+};
+
 class IUncertainty
 {
   public:
@@ -16,6 +37,11 @@ class IUncertainty
                      auto *const model = static_cast<Model *>(uncertaintyApproachBytes);
                      delete model;
                  }),
+          clone_([](void *uncertaintyApproachBytes) -> void * {
+              using Model = OwningModel<UncertaintyApproachT>;
+              auto *const model = static_cast<Model *>(uncertaintyApproachBytes);
+              return new Model(*model);
+          }),
           uncertaintyOperation_([](void *uncertaintyApproachBytes,
                                    const std::vector<double> &values, const int numCoreErrMember,
                                    const double cl, PDFUncertainty &uncertainty) -> void {
@@ -30,11 +56,23 @@ class IUncertainty
                   auto *const model = static_cast<Model *>(uncertaintyApproachBytes);
                   return model->Correlation(valuesA, valuesB, numCoreErrMember);
               }),
-          clone_([](void *uncertaintyApproachBytes) -> void * {
-              using Model = OwningModel<UncertaintyApproachT>;
-              auto *const model = static_cast<Model *>(uncertaintyApproachBytes);
-              return new Model(*model);
-          })
+          uncertaintyBlockOperation_(
+              [](void *uncertaintyApproachBytes, const std::vector<double> &values,
+                 size_t nPoints, const int numCoreErrMember, const double cl,
+                 std::vector<PDFUncertainty> &uncertainties) -> void {
+                  using Model = OwningModel<UncertaintyApproachT>;
+                  auto *const model = static_cast<Model *>(uncertaintyApproachBytes);
+                  return model->Uncertainty(values, nPoints, numCoreErrMember, cl, uncertainties);
+              }),
+          correlationBlockOperation_(
+              [](void *uncertaintyApproachBytes, const std::vector<double> &valuesA,
+                 const std::vector<double> &valuesB, size_t nPoints, const int numCoreErrMember,
+                 std::vector<double> &correlations) -> void {
+                  using Model = OwningModel<UncertaintyApproachT>;
+                  auto *const model = static_cast<Model *>(uncertaintyApproachBytes);
+                  return model->Correlation(valuesA, valuesB, nPoints, numCoreErrMember,
+                                            correlations);
+              })
     {
     }
 
@@ -49,6 +87,33 @@ class IUncertainty
     {
         return correlationOperation_(pimpl_.get(), valuesA, valuesB, numCoreErrMember);
     }
+
+    /**
+     * @brief Calculates the uncertainties of many points at once.
+     * @param values Block of nPoints x members values; row p holds all members at point p.
+     * @param nPoints Number of points (rows) in the block.
+     * @param numCoreErrMember Number of core error members.
+     * @param cl Confidence level for the uncertainty calculation (if applicable).
+     * @param uncertainties Output, one entry per point.
+     */
+    void Uncertainty(const std::vector<double> &values, size_t nPoints, const int numCoreErrMember,
+                     const double cl, std::vector<PDFUncertainty> &uncertainties) const
+    {
+        uncertaintyBlockOperation_(pimpl_.get(), values, nPoints, numCoreErrMember, cl,
+                                   uncertainties);
+    }
+
+    /**
+     * @brief Calculates the correlation between row p of valuesA and row p of valuesB for every
+     * point of two nPoints x members blocks.
+     */
+    void Correlation(const std::vector<double> &valuesA, const std::vector<double> &valuesB,
+                     size_t nPoints, const int numCoreErrMember,
+                     std::vector<double> &correlations) const
+    {
+        correlationBlockOperation_(pimpl_.get(), valuesA, valuesB, nPoints, numCoreErrMember,
+                                   correlations);
+    }
     /**
      * @brief Copy constructor for ICPDF objects.
      *
@@ -58,8 +123,10 @@ class IUncertainty
      */
     IUncertainty(const IUncertainty &other)
         : pimpl_(other.clone_(other.pimpl_.get()), other.pimpl_.get_deleter()),
-          clone_(other.clone_), correlationOperation_(other.correlationOperation_),
-          uncertaintyOperation_(other.uncertaintyOperation_)
+          clone_(other.clone_), uncertaintyOperation_(other.uncertaintyOperation_),
+          correlationOperation_(other.correlationOperation_),
+          uncertaintyBlockOperation_(other.uncertaintyBlockOperation_),
+          correlationBlockOperation_(other.correlationBlockOperation_)
     {
     }
 
@@ -79,6 +146,8 @@ class IUncertainty
         swap(clone_, copy.clone_);
         swap(correlationOperation_, copy.correlationOperation_);
         swap(uncertaintyOperation_, copy.uncertaintyOperation_);
+        swap(uncertaintyBlockOperation_, copy.uncertaintyBlockOperation_);
+        swap(correlationBlockOperation_, copy.correlationBlockOperation_);
         return *this;
     }
 
@@ -104,6 +173,50 @@ class IUncertainty
         {
             return uncertaintyApporach_.Uncertainty(values, numCoreErrMember, cl, uncertainty);
         }
+        void Uncertainty(const std::vector<double> &values, size_t nPoints,
+                         const int numCoreErrMember, const double cl,
+                         std::vector<PDFUncertainty> &uncertainties)
+        {
+            if constexpr (HasBlockUncertainty<UncertaintyApproachT>::value)
+            {
+                uncertaintyApporach_.Uncertainty(values, nPoints, numCoreErrMember, cl,
+                                                 uncertainties);
+            }
+            else
+            {
+                uncertainties.resize(nPoints);
+                const size_t nMembers = nPoints > 0 ? values.size() / nPoints : 0;
+                std::vector<double> row(nMembers);
+                for (size_t p = 0; p < nPoints; ++p)
+                {
+                    std::copy_n(values.begin() + p * nMembers, nMembers, row.begin());
+                    uncertaintyApporach_.Uncertainty(row, numCoreErrMember, cl, uncertainties[p]);
+                }
+            }
+        }
+        void Correlation(const std::vector<double> &valuesA, const std::vector<double> &valuesB,
+                         size_t nPoints, const int numCoreErrMember,
+                         std::vector<double> &correlations)
+        {
+            if constexpr (HasBlockUncertainty<UncertaintyApproachT>::value)
+            {
+                uncertaintyApporach_.Correlation(valuesA, valuesB, nPoints, numCoreErrMember,
+                                                 correlations);
+            }
+            else
+            {
+                correlations.resize(nPoints);
+                const size_t nMembers = nPoints > 0 ? valuesA.size() / nPoints : 0;
+                std::vector<double> rowA(nMembers), rowB(nMembers);
+                for (size_t p = 0; p < nPoints; ++p)
+                {
+                    std::copy_n(valuesA.begin() + p * nMembers, nMembers, rowA.begin());
+                    std::copy_n(valuesB.begin() + p * nMembers, nMembers, rowB.begin());
+                    correlations[p] =
+                        uncertaintyApporach_.Correlation(rowA, rowB, numCoreErrMember);
+                }
+            }
+        }
         UncertaintyApproachT uncertaintyApporach_;
     };
 
@@ -113,10 +226,17 @@ class IUncertainty
                                       PDFUncertainty &);
     using CorrelationOperation = double(void *, const std::vector<double> &,
                                         const std::vector<double> &, const int);
+    using UncertaintyBlockOperation = void(void *, const std::vector<double> &, size_t, const int,
+                                           const double, std::vector<PDFUncertainty> &);
+    using CorrelationBlockOperation = void(void *, const std::vector<double> &,
+                                           const std::vector<double> &, size_t, const int,
+                                           std::vector<double> &);
 
     std::unique_ptr<void, DestroyOperation *> pimpl_;
     CloneOperation *clone_{nullptr};
     UncertaintyOperation *uncertaintyOperation_{nullptr};
     CorrelationOperation *correlationOperation_{nullptr};
+    UncertaintyBlockOperation *uncertaintyBlockOperation_{nullptr};
+    CorrelationBlockOperation *correlationBlockOperation_{nullptr};
 };
 } // namespace PDFxTMD
@@ -0,0 +1,189 @@
+#pragma once
+#include "PDFxTMDLib/GenericPDF.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CContinuationExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CErrExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/Collinear/CNearestPointExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/TMD/TErrExtrapolator.h"
+#include "PDFxTMDLib/Implementation/Extrapolator/TMD/TZeroExtrapolator.h"
+#include "PDFxTMDLib/Interface/ICPDF.h"
+#include "PDFxTMDLib/Interface/ITMD.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace PDFxTMD
+{
+/// Interface the factories return for a PDF tag
+template <typename Tag> struct RegistryInterface;
+template <> struct RegistryInterface<CollinearPDFTag>
+{
+    using type = ICPDF;
+};
+template <> struct RegistryInterface<TMDPDFTag>
+{
+    using type = ITMD;
+};
+
+/**
+ * @brief Extrapolator entries for PDFRegistry::registerInterpolator.
+ *
+ * An entry gives the name used in the "Extrapolator" field of the info file and the extrapolator
+ * type to use with a given interpolator.
+ */
+struct CContinuationExtrapolatorEntry
+{
+    static constexpr const char *name = "CContinuationExtrapolator";
+    template <typename Interpolator> using type = CContinuationExtrapolator<Interpolator>;
+};
+struct CErrExtrapolatorEntry
+{
+    static constexpr const char *name = "CErrExtrapolator";
+    template <typename Interpolator> using type = CErrExtrapolator;
+};
+struct CNearestPointExtrapolatorEntry
+{
+    static constexpr const char *name = "CNearestPointExtrapolator";
+    template <typename Interpolator> using type = CNearestPointExtrapolator<Interpolator>;
+};
+struct TZeroExtrapolatorEntry
+{
+    static constexpr const char *name = "TZeroExtrapolator";
+    template <typename Interpolator> using type = TZeroExtrapolator;
+};
+struct TErrExtrapolatorEntry
+{
+    static constexpr const char *name = "TErrExtrapolator";
+    template <typename Interpolator> using type = TErrExtrapolator;
+};
+/// Name under which earlier releases selected TErrExtrapolator, kept for existing info files
+struct TExtrapolatorEntry
+{
+    static constexpr const char *name = "TExtrapolator";
+    template <typename Interpolator> using type = TErrExtrapolator;
+};
+
+/// Extrapolators a newly registered interpolator is combined with by default
+template <typename Tag> struct DefaultExtrapolators;
+template <> struct DefaultExtrapolators<CollinearPDFTag>
+{
+    using type = std::tuple<CContinuationExtrapolatorEntry, CErrExtrapolatorEntry,
+                            CNearestPointExtrapolatorEntry>;
+};
+template <> struct DefaultExtrapolators<TMDPDFTag>
+{
+    using type = std::tuple<TZeroExtrapolatorEntry, TErrExtrapolatorEntry, TExtrapolatorEntry>;
+};
+
+/**
+ * @brief Maps the Reader, Interpolator and Extrapolator names of an info file to a function that
+ * creates the matching GenericPDF.
+ *
+ * GenericCPDFFactory and GenericTMDFactory look up their PDFs here, so a new implementation can
+ * be selected from the info file without changing the factories. Register it once before the
+ * factory is used:
+ *
+ * @code
+ * CPDFRegistry::instance()
+ *     .registerInterpolator<CDefaultLHAPDFFileReader, MyInterpolator>("CDefaultLHAPDFFileReader",
+ *                                                                      "MyInterpolator");
+ * @endcode
+ *
+ * which instantiates GenericPDF for MyInterpolator with every default extrapolator. To register
+ * during static initialization, define a PDFRegistrar at namespace scope. The built-in
+ * implementations are registered when the registry is first used.
+ */
+template <typename Tag> class PDFRegistry
+{
+  public:
+    using Interface = typename RegistryInterface<Tag>::type;
+    /// Creates member @p setMember of the set described by @p metadata
+    using Maker = Interface (*)(const SetMetadata &metadata, int setMember);
+
+    static PDFRegistry &instance();
+
+    /// Registers @p maker for the given names, replacing any earlier registration.
+    void add(const std::string &reader, const std::string &interpolator,
+             const std::string &extrapolator, Maker maker)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_makers[Key(reader, interpolator, extrapolator)] = maker;
+    }
+    /// Returns the maker registered for the given names, or nullptr.
+    Maker find(const std::string &reader, const std::string &interpolator,
+               const std::string &extrapolator) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_makers.find(Key(reader, interpolator, extrapolator));
+        return it == m_makers.end() ? nullptr : it->second;
+    }
+    /// Registered combinations, as "Reader/Interpolator/Extrapolator"
+    std::vector<std::string> names() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> result;
+        result.reserve(m_makers.size());
+        for (const auto &entry : m_makers)
+            result.push_back(std::get<0>(entry.first) + "/" + std::get<1>(entry.first) + "/" +
+                             std::get<2>(entry.first));
+        return result;
+    }
+
+    /// Registers GenericPDF<Tag, ReaderT, InterpolatorT, ExtrapolatorT> under the given names.
+    template <typename ReaderT, typename InterpolatorT, typename ExtrapolatorT>
+    void registerImplementation(const std::string &reader, const std::string &interpolator,
+                                const std::string &extrapolator)
+    {
+        add(reader, interpolator, extrapolator, [](const SetMetadata &metadata, int setMember) {
+            return Interface(
+                GenericPDF<Tag, ReaderT, InterpolatorT, ExtrapolatorT>(metadata, setMember));
+        });
+    }
+    /**
+     * @brief Registers InterpolatorT<ReaderT> with every extrapolator entry in Extrapolators.
+     *
+     * @tparam Extrapolators std::tuple of extrapolator entries, by default all built-in
+     * extrapolators of the tag.
+     */
+    template <typename ReaderT, template <typename> class InterpolatorT,
+              typename Extrapolators = typename DefaultExtrapolators<Tag>::type>
+    void registerInterpolator(const std::string &reader, const std::string &interpolator)
+    {
+        registerWithExtrapolators<ReaderT, InterpolatorT<ReaderT>>(
+            reader, interpolator, static_cast<Extrapolators *>(nullptr));
+    }
+
+  private:
+    using Key = std::tuple<std::string, std::string, std::string>;
+
+    template <typename ReaderT, typename InterpolatorT, typename... Entries>
+    void registerWithExtrapolators(const std::string &reader, const std::string &interpolator,
+                                   std::tuple<Entries...> *)
+    {
+        (registerImplementation<ReaderT, InterpolatorT,
+                                typename Entries::template type<InterpolatorT>>(
+             reader, interpolator, Entries::name),
+         ...);
+    }
+
+    mutable std::mutex m_mutex;
+    std::map<Key, Maker> m_makers;
+};
+
+template <> PDFRegistry<CollinearPDFTag> &PDFRegistry<CollinearPDFTag>::instance();
+template <> PDFRegistry<TMDPDFTag> &PDFRegistry<TMDPDFTag>::instance();
+
+using CPDFRegistry = PDFRegistry<CollinearPDFTag>;
+using TMDRegistry = PDFRegistry<TMDPDFTag>;
+
+/// Runs a registration during static initialization, e.g.
+/// `static PDFRegistrar registrar([] { CPDFRegistry::instance().registerInterpolator<...>(...); });`
+struct PDFRegistrar
+{
+    template <typename Registration> explicit PDFRegistrar(Registration &&registration)
+    {
+        registration();
+    }
+};
+} // namespace PDFxTMD
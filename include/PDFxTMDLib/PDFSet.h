@@ -8,8 +8,11 @@
 #include "PDFxTMDLib/Interface/ICPDF.h"
 #include "PDFxTMDLib/Interface/ITMD.h"
 #include <PDFxTMDLib/Common/Exception.h>
+#include <PDFxTMDLib/Common/Instrumentation.h>
 #include <PDFxTMDLib/Common/MathUtils.h>
 #include <PDFxTMDLib/Common/PDFErrInfo.h>
+#include <PDFxTMDLib/Common/ThreadPool.h>
+#include <PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h>
 #include <PDFxTMDLib/Common/YamlMetaInfo/YamlErrorInfo.h>
 #include <PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h>
 #include <PDFxTMDLib/Factory.h>
@@ -22,6 +25,9 @@
 #include <PDFxTMDLib/Uncertainty/ReplicasStdDevStrategy.h>
 #include <PDFxTMDLib/Uncertainty/SymmHessianStrategy.h>
 #include <PDFxTMDLib/Common/Logger.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -71,9 +77,10 @@ template <typename Tag> class PDFSet
         : m_pdfSetName(std::move(pdfSetName)),
           m_alternativeReplicaUncertainty(alternativeReplicaUncertainty),
           m_uncertaintyStrategy_(NullUncertaintyStrategy()),
-          m_qcdCoupling(CouplingFactory().mkCoupling(m_pdfSetName))
+          m_qcdCoupling(NullQCDCoupling())
     {
         Initialize();
+        InitializeQCDCoupling();
         CreateAllPDFSets();
     }
 
@@ -100,19 +107,38 @@ template <typename Tag> class PDFSet
         return m_qcdCoupling.AlphaQCDMu2(q2);
     }
 
+    /**
+     * @brief Get alpha_s at n squared scales, through the batch path of the coupling.
+     * @param q2 The n squared momentum transfer scales Q^2 in GeV^2.
+     * @param alphas The output buffer of n values of alpha_s(Q^2).
+     * @param n The number of scales.
+     */
+    void alphasQ2(const double *q2, double *alphas, size_t n) const
+    {
+        m_qcdCoupling.AlphaQCDMu2(q2, alphas, n);
+    }
+
     /**
      * @brief Access a specific PDF member from the set.
+     *
+     * Members that are already loaded are returned without locking; a missing member is created
+     * under a lock and published atomically, so concurrent callers may share the set.
      * @param member The member index (0 is the central value).
      * @return A pointer to the PDF object. Creates the object if it doesn't exist.
      */
     PDF_t *operator[](int member)
     {
-        std::lock_guard<std::mutex> lock(m_pdfSetMtx);
-        if (m_PDFSet_.find(member) == m_PDFSet_.end())
+        if (member < 0 || static_cast<size_t>(member) >= m_PDFSet_.size())
+            throw InvalidInputError("PDFxTMD::PDFSet::operator[]: member " +
+                                    std::to_string(member) + " is out of range for PDF set " +
+                                    m_pdfSetName + ".");
+        PDF_t *pdf = m_PDFSet_[member].load(std::memory_order_acquire);
+        if (pdf == nullptr)
         {
             CreatePDFSet(member);
+            pdf = m_PDFSet_[member].load(std::memory_order_acquire);
         }
-        return m_PDFSet_[member].get();
+        return pdf;
     }
 
     /**
@@ -122,9 +148,9 @@ template <typename Tag> class PDFSet
      */
     PDF_t *operator[](int member) const
     {
-        if (m_PDFSet_.find(member) == m_PDFSet_.end())
+        if (member < 0 || static_cast<size_t>(member) >= m_PDFSet_.size())
             return nullptr;
-        return m_PDFSet_.at(member).get();
+        return m_PDFSet_[member].load(std::memory_order_acquire);
     }
 
     /**
@@ -197,6 +223,45 @@ template <typename Tag> class PDFSet
         return resUncertainty;
     }
     
+    /**
+     * @brief Calculate the TMD uncertainty at nPoints points. (Enabled only for TMDPDFTag)
+     *
+     * Every member is evaluated at all points through the batch TMD path, members being spread
+     * over the global ThreadPool as in the single-point version.
+     * @param flavor The parton flavor.
+     * @param x The nPoints momentum fractions.
+     * @param kt2 The nPoints squared transverse momenta.
+     * @param mu2 The nPoints squared factorization scales.
+     * @param nPoints The number of points.
+     * @param cl The desired confidence level in percent.
+     * @param resUncertainties The output PDFUncertainty objects, one per point.
+     */
+    template <typename T = Tag, typename = std::enable_if_t<std::is_same_v<T, TMDPDFTag>>>
+    void Uncertainty(PartonFlavor flavor, const double *x, const double *kt2, const double *mu2,
+                     size_t nPoints, double cl, std::vector<PDFUncertainty> &resUncertainties)
+    {
+        const auto values = CalculatePDFValueBlock(flavor, nPoints, x, kt2, mu2);
+        Uncertainty(values, nPoints, cl, resUncertainties);
+    }
+
+    /**
+     * @brief Calculate the collinear PDF uncertainty at nPoints points. (Enabled only for
+     * CollinearPDFTag)
+     * @param flavor The parton flavor.
+     * @param x The nPoints momentum fractions.
+     * @param mu2 The nPoints squared factorization scales.
+     * @param nPoints The number of points.
+     * @param cl The desired confidence level in percent.
+     * @param resUncertainties The output PDFUncertainty objects, one per point.
+     */
+    template <typename T = Tag, typename = std::enable_if_t<std::is_same_v<T, CollinearPDFTag>>>
+    void Uncertainty(PartonFlavor flavor, const double *x, const double *mu2, size_t nPoints,
+                     double cl, std::vector<PDFUncertainty> &resUncertainties)
+    {
+        const auto values = CalculatePDFValueBlock(flavor, nPoints, x, mu2);
+        Uncertainty(values, nPoints, cl, resUncertainties);
+    }
+
     /**
      * @brief Calculate uncertainty from a pre-computed vector of PDF values.
      * @param values A vector of PDF values from all members of the set.
@@ -228,6 +293,36 @@ template <typename Tag> class PDFSet
         return resUncertainty;
     }
     
+    /**
+     * @brief Calculate uncertainties for many points from a block of pre-computed PDF values.
+     * @param values Block of nPoints x size() values; row p holds all members at point p.
+     * @param nPoints The number of points (rows) in the block.
+     * @param cl The desired confidence level in percent.
+     * @param resUncertainties The output PDFUncertainty objects, one per point.
+     */
+    void Uncertainty(const std::vector<double> &values, size_t nPoints, double cl,
+                     std::vector<PDFUncertainty> &resUncertainties)
+    {
+        if (values.size() != nPoints * m_pdfSetErrorInfo.size)
+            throw InvalidInputError("Error in PDFxTMD::PDFSet::Uncertainty. Input block must "
+                                    "contain values for all PDF members at every point.");
+        PDFXTMD_INSTRUMENT_GLOBAL(Uncertainty, nPoints);
+        const double reqCL = ValidateAndGetCL(cl);
+        // A reused vector must not keep the errparts and scale of earlier calls
+        resUncertainties.assign(nPoints, PDFUncertainty());
+        m_uncertaintyStrategy_.Uncertainty(values, nPoints, m_pdfErrInfo.nmemCore(), reqCL,
+                                           resUncertainties);
+        ApplyConfidenceLevelScaling(resUncertainties, reqCL);
+        for (size_t p = 0; p < nPoints; ++p)
+        {
+            const double *pdfs = values.data() + p * m_pdfSetErrorInfo.size;
+            PDFUncertainty &resUncertainty = resUncertainties[p];
+            resUncertainty.central = pdfs[0];
+            StoreCoreVariationErros(resUncertainty);
+            CalculateParameterVariationErrors(resUncertainty, pdfs);
+        }
+    }
+
     /**
      * @brief Calculate the correlation for collinear PDFs. (Enabled only for CollinearPDFTag)
      * @param flavorA The parton flavor for the first observable.
@@ -283,52 +378,86 @@ template <typename Tag> class PDFSet
     }
 
     /**
-     * @brief Explicitly creates a single PDF member.
+     * @brief Calculate correlations point by point from two blocks of pre-computed PDF values.
+     * @param valuesA Block of nPoints x size() values for the first observable.
+     * @param valuesB Block of nPoints x size() values for the second observable.
+     * @param nPoints The number of points (rows) in each block.
+     * @return The correlation between row p of valuesA and row p of valuesB, for every p.
+     */
+    std::vector<double> Correlation(const std::vector<double> &valuesA,
+                                    const std::vector<double> &valuesB, size_t nPoints) const
+    {
+        if (valuesA.size() != nPoints * m_pdfSetErrorInfo.size ||
+            valuesB.size() != nPoints * m_pdfSetErrorInfo.size)
+            throw InvalidInputError("Error in PDFxTMD::PDFSet::Correlation. Input blocks must "
+                                    "contain values for all PDF members at every point.");
+        std::vector<double> correlations;
+        m_uncertaintyStrategy_.Correlation(valuesA, valuesB, nPoints, m_pdfErrInfo.nmemCore(),
+                                           correlations);
+        return correlations;
+    }
+
+    /**
+     * @brief Explicitly creates a single PDF member. Members that already exist are kept, since
+     * pointers to them may be in use by other threads.
      * @param setMember The index of the PDF member to create.
      */
     void CreatePDFSet(unsigned int setMember)
     {
+        if (setMember >= m_PDFSet_.size())
+            throw InvalidInputError("PDFxTMD::PDFSet::CreatePDFSet: member " +
+                                    std::to_string(setMember) + " is out of range for PDF set " +
+                                    m_pdfSetName + ".");
+
+        std::lock_guard<std::mutex> lock(*m_pdfSetMtx);
+        if (m_PDFSet_[setMember].load(std::memory_order_relaxed) != nullptr)
+            return;
+
+        std::unique_ptr<PDF_t> pdf;
+        if constexpr (std::is_same_v<Tag, TMDPDFTag>)
         {
-            if constexpr (std::is_same_v<Tag, TMDPDFTag>)
-            {
-                m_PDFSet_.insert_or_assign(
-                    setMember, std::make_unique<PDF_t>(
-                                   PDFxTMD::GenericTMDFactory().mkTMD(m_pdfSetName, setMember)));
-            }
-            else if constexpr (std::is_same_v<Tag, CollinearPDFTag>)
-            {
-                m_PDFSet_.insert_or_assign(
-                    setMember, std::make_unique<PDF_t>(
-                                   PDFxTMD::GenericCPDFFactory().mkCPDF(m_pdfSetName, setMember)));
-            }
-            else
-            {
-                static_assert(!std::is_same_v<Tag, Tag>, "Unsupported Tag");
-            }
+            pdf = std::make_unique<PDF_t>(
+                PDFxTMD::GenericTMDFactory().mkTMD(*m_metadata, setMember));
         }
+        else if constexpr (std::is_same_v<Tag, CollinearPDFTag>)
+        {
+            pdf = std::make_unique<PDF_t>(
+                PDFxTMD::GenericCPDFFactory().mkCPDF(*m_metadata, setMember));
+        }
+        else
+        {
+            static_assert(!std::is_same_v<Tag, Tag>, "Unsupported Tag");
+        }
+        m_PDFSet_[setMember].store(pdf.get(), std::memory_order_release);
+        m_PDFSetOwner_[setMember] = std::move(pdf);
     }
-    
+
     /**
      * @brief Pre-loads all PDF members in the set.
      */
     void CreateAllPDFSets()
     {
-        for (int i = 0; i < m_pdfSetStdInfo.NumMembers; ++i)
+        for (size_t i = 0; i < m_PDFSet_.size(); ++i)
         {
-            if (m_PDFSet_.find(i) == m_PDFSet_.end()) {
+            if (m_PDFSet_[i].load(std::memory_order_acquire) == nullptr)
+            {
                 CreatePDFSet(i);
             }
         }
     }
-    
+
     /**
-     * @brief Re-initializes the PDFSet with a new PDF set name.
+     * @brief Re-initializes the PDFSet with a new PDF set name. Members of the previous set are
+     * released and those of the new set are loaded, so no other thread may be using this set
+     * while it is re-initialized.
      * @param pdfSetName The name of the new PDF set.
      */
     void InitailizePDFSetName(std::string pdfSetName)
     {
         m_pdfSetName = std::move(pdfSetName);
         Initialize();
+        InitializeQCDCoupling();
+        CreateAllPDFSets();
     }
     
     /**
@@ -340,6 +469,18 @@ template <typename Tag> class PDFSet
         return m_pdfSetStdInfo.NumMembers;
     }
 
+    /**
+     * @brief Limits the number of threads used to evaluate the members of this set.
+     *
+     * Parallel evaluation only happens once the global pool has been enabled with
+     * `ThreadPool::SetGlobalThreads`; by default members are evaluated serially.
+     * @param maxThreads Maximum number of threads (caller included), zero means the whole pool.
+     */
+    void SetMaxThreads(size_t maxThreads)
+    {
+        m_maxThreads = maxThreads;
+    }
+
     /**
      * @brief Get the standard metadata for the PDF set.
      * @return A YamlStandardPDFInfo object.
@@ -364,7 +505,7 @@ template <typename Tag> class PDFSet
      */
     ConfigWrapper info()
     {
-        return m_pdfSetInfo;
+        return m_metadata ? *m_metadata->config : ConfigWrapper();
     }
     
     // Rule of Five: disable copying, allow moving.
@@ -374,6 +515,10 @@ template <typename Tag> class PDFSet
     PDFSet &operator=(PDFSet &&) = default;
 
   private:
+    /// @brief Smallest chunk of members handed to a worker; collinear members are cheap enough
+    /// that small chunks would cost more in scheduling than they save.
+    static constexpr size_t MinMembersPerTask = std::is_same_v<Tag, TMDPDFTag> ? 4 : 32;
+
     /**
      * @brief Internal routine for uncertainty calculation.
      * @param pdfs A vector of PDF values from all set members.
@@ -383,6 +528,7 @@ template <typename Tag> class PDFSet
     inline void PDFUncertaintyInternalEvaluation(const std::vector<double> &pdfs, double cl,
                                                  PDFUncertainty &resUncertainty)
     {
+        PDFXTMD_INSTRUMENT_GLOBAL(Uncertainty, 1);
         const double reqCL = ValidateAndGetCL(cl);
 
         m_uncertaintyStrategy_.Uncertainty(pdfs, m_pdfErrInfo.nmemCore(), reqCL, resUncertainty);
@@ -390,7 +536,7 @@ template <typename Tag> class PDFSet
 
         ApplyConfidenceLevelScaling(resUncertainty, reqCL);
         StoreCoreVariationErros(resUncertainty);
-        CalculateParameterVariationErrors(resUncertainty, pdfs);
+        CalculateParameterVariationErrors(resUncertainty, pdfs.data());
     }
     
     /// @brief Initializes the PDF set by loading metadata and preparing strategies.
@@ -399,12 +545,14 @@ template <typename Tag> class PDFSet
         ValidatePDFSetName();
         LoadYamlInfo();
         InitializeUncertaintyStrategy();
+        m_PDFSet_ = std::vector<std::atomic<PDF_t *>>(m_pdfSetStdInfo.NumMembers);
+        m_PDFSetOwner_ = std::vector<std::unique_ptr<PDF_t>>(m_pdfSetStdInfo.NumMembers);
     }
 
     /// @brief Initializes the QCD coupling object.
     void InitializeQCDCoupling()
     {
-        m_qcdCoupling = CouplingFactory().mkCoupling(m_pdfSetName);
+        m_qcdCoupling = CouplingFactory().mkCoupling(*m_metadata);
     }
 
     /// @brief Validates that the PDF set name is not empty.
@@ -417,17 +565,18 @@ template <typename Tag> class PDFSet
         }
     }
 
-    /// @brief Loads all metadata from the .info YAML file.
+    /// @brief Loads all metadata from the .info YAML file, shared with the members of the set.
     void LoadYamlInfo()
     {
-        auto infoPathPair = StandardInfoFilePath(m_pdfSetName);
-        if (infoPathPair.second != ErrorType::None)
+        auto metadataPair = SetMetadataReader(m_pdfSetName);
+        if (metadataPair.second != ErrorType::None)
             throw FileLoadException(
                 "PDFxTMD::PDFSet::LoadYamlInfo: Unable to find info file of PDF set " +
                 m_pdfSetName);
+        m_metadata = metadataPair.first;
 
         m_isValid = true;
-        auto yamlInfoErrPair = YamlErrorInfoReader(*infoPathPair.first);
+        const auto &yamlInfoErrPair = m_metadata->errorInfo;
         if (yamlInfoErrPair.second != ErrorType::None || !yamlInfoErrPair.first.has_value())
         {
             m_isValid = false;
@@ -437,7 +586,7 @@ template <typename Tag> class PDFSet
             m_pdfSetErrorInfo = *yamlInfoErrPair.first;
         }
 
-        auto yamlStdInfoErrPair = YamlStandardPDFInfoReader(*infoPathPair.first);
+        const auto &yamlStdInfoErrPair = m_metadata->standardInfo;
         if (yamlStdInfoErrPair.second != ErrorType::None || !yamlStdInfoErrPair.first.has_value())
         {
             m_isValid = false;
@@ -452,10 +601,6 @@ template <typename Tag> class PDFSet
             throw InvalidInputError("PDFSet: Invalid PDF set '" + m_pdfSetName +
                                     "'. Please check the YAML file.");
         }
-        if (!m_pdfSetInfo.loadFromFile(*infoPathPair.first, ConfigWrapper::Format::YAML))
-        {
-            throw FileLoadException("path: " + *infoPathPair.first + "not found.");
-        }
     }
 
     /// @brief Selects and initializes the correct uncertainty calculation strategy.
@@ -505,26 +650,76 @@ template <typename Tag> class PDFSet
             (coreType != "replicas") ? m_pdfSetErrorInfo.ErrorConfLevel / 100.0 : CL1SIGMA / 100.0;
     }
 
+    /// @brief Evaluates fn(begin, end) over the members [0, n) on the global ThreadPool, or
+    /// directly on this thread when the pool has no workers or this set is limited to one thread.
+    template <typename Function>
+    void ForEachMemberRange(size_t n, size_t grain, const Function &fn) const
+    {
+        if (ThreadPool::GlobalThreads() == 0 || m_maxThreads == 1 || n <= grain)
+        {
+            fn(0, n);
+            return;
+        }
+        ThreadPool::Global()->ParallelFor(n, grain, fn, m_maxThreads);
+    }
+
     /// @brief Calculates PDF values for all members of the set for a given kinematic point.
+    /// Members are split into chunks over the global ThreadPool when it has workers; each value
+    /// is written at its member index, so the result does not depend on scheduling.
     template <typename... Args>
     std::vector<double> CalculatePDFValues(PartonFlavor flavor, Args... args) const
     {
-        std::vector<double> pdfs;
-        pdfs.reserve(m_pdfSetStdInfo.NumMembers);
-        for (size_t i = 0; i < size(); i++)
-        {
-            if constexpr (sizeof...(args) == 3)
-            { // TMD case
-                pdfs.emplace_back(operator[](i)->tmd(flavor, args...));
-            }
-            else
-            { // Collinear case
-                pdfs.emplace_back(operator[](i)->pdf(flavor, args...));
+        std::vector<double> pdfs(size());
+        const auto evaluateRange = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                if constexpr (sizeof...(args) == 3)
+                { // TMD case
+                    pdfs[i] = operator[](i)->tmd(flavor, args...);
+                }
+                else
+                { // Collinear case
+                    pdfs[i] = operator[](i)->pdf(flavor, args...);
+                }
             }
-        }
+        };
+        ForEachMemberRange(pdfs.size(), MinMembersPerTask, evaluateRange);
         return pdfs;
     }
     
+    /// @brief Calculates PDF values for all members of the set at nPoints kinematic points, as
+    /// the nPoints x size() block the block Uncertainty expects. Each member evaluates all points
+    /// in one batch call, and members are split over the global ThreadPool.
+    template <typename... Args>
+    std::vector<double> CalculatePDFValueBlock(PartonFlavor flavor, size_t nPoints,
+                                               const Args *...args) const
+    {
+        const size_t nMembers = size();
+        std::vector<double> block(nPoints * nMembers);
+        const auto evaluateRange = [&](size_t begin, size_t end) {
+            std::vector<double> values(nPoints);
+            for (size_t i = begin; i < end; i++)
+            {
+                if constexpr (sizeof...(args) == 3)
+                { // TMD case
+                    operator[](i)->tmd(flavor, args..., values.data(), nPoints);
+                }
+                else
+                { // Collinear case
+                    const PDF_t *pdf = operator[](i);
+                    for (size_t p = 0; p < nPoints; ++p)
+                        values[p] = pdf->pdf(flavor, args[p]...);
+                }
+                for (size_t p = 0; p < nPoints; ++p)
+                    block[p * nMembers + i] = values[p];
+            }
+        };
+        const size_t minMembersPerTask =
+            std::max<size_t>(1, MinMembersPerTask / std::max<size_t>(nPoints, 1));
+        ForEachMemberRange(nMembers, minMembersPerTask, evaluateRange);
+        return block;
+    }
+
     /// @brief Validates and returns the confidence level for calculations.
     double ValidateAndGetCL(double cl) const
     {
@@ -542,16 +737,52 @@ template <typename Tag> class PDFSet
     void ApplyConfidenceLevelScaling(PDFUncertainty &rtn, double reqCL) const
     {
         if (m_setCL != reqCL && !m_alternativeReplicaUncertainty)
+            ApplyScale(rtn, ConfidenceLevelScale(reqCL));
+    }
+
+    /// @brief Scales a block of uncertainties that share the same requested confidence level.
+    void ApplyConfidenceLevelScaling(std::vector<PDFUncertainty> &rtn, double reqCL) const
+    {
+        if (m_setCL == reqCL || m_alternativeReplicaUncertainty)
+            return;
+        const double scale = ConfidenceLevelScale(reqCL);
+        for (auto &uncertainty : rtn)
+            ApplyScale(uncertainty, scale);
+    }
+
+    /// @brief Multiplies the errors by a confidence level scale factor.
+    static void ApplyScale(PDFUncertainty &rtn, double scale)
+    {
+        rtn.scale = scale;
+        rtn.errplus *= scale;
+        rtn.errminus *= scale;
+        rtn.errsymm *= scale;
+    }
+
+    /// @brief Returns sqrt(q(reqCL) / q(setCL)) for the chi-squared quantile q with one degree of
+    /// freedom. Both quantiles iterate igam/igamc, while the CL pair rarely changes between
+    /// calls, so the last few pairs are memoized per thread; this keeps shared sets lock-free.
+    double ConfidenceLevelScale(double reqCL) const
+    {
+        struct CachedScale
+        {
+            double setCL = -1;
+            double reqCL = -1;
+            double scale = 1;
+        };
+        thread_local std::array<CachedScale, 4> cache{};
+        thread_local size_t nextSlot = 0;
+        for (const auto &entry : cache)
         {
-            double qsetCL = chisquared_quantile(m_setCL, 1);
-            double qreqCL = chisquared_quantile(reqCL, 1);
-            const double scale = std::sqrt(qreqCL / qsetCL);
-
-            rtn.scale = scale;
-            rtn.errplus *= scale;
-            rtn.errminus *= scale;
-            rtn.errsymm *= scale;
+            if (entry.setCL == m_setCL && entry.reqCL == reqCL)
+                return entry.scale;
         }
+        const double qsetCL = chisquared_quantile(m_setCL, 1);
+        const double qreqCL = chisquared_quantile(reqCL, 1);
+        const double scale = std::sqrt(qreqCL / qsetCL);
+        cache[nextSlot] = {m_setCL, reqCL, scale};
+        nextSlot = (nextSlot + 1) % cache.size();
+        return scale;
     }
 
     /// @brief Stores the core PDF variation errors into the result struct.
@@ -567,8 +798,7 @@ template <typename Tag> class PDFSet
     }
 
     /// @brief Calculates errors from parameter variations (e.g., alpha_s, quark masses).
-    void CalculateParameterVariationErrors(PDFUncertainty &rtn,
-                                           const std::vector<double> &values) const
+    void CalculateParameterVariationErrors(PDFUncertainty &rtn, const double *values) const
     {
         double errsq_par_plus = 0.0;
         double errsq_par_minus = 0.0;
@@ -608,18 +838,20 @@ template <typename Tag> class PDFSet
         }
     }
     std::string m_pdfSetName;                   ///< The name of the PDF set.
-    ConfigWrapper m_pdfSetInfo;                 ///< General metadata object for the set.
+    std::shared_ptr<const SetMetadata> m_metadata; ///< Parsed info file shared with the members.
     YamlErrorInfo m_pdfSetErrorInfo;           ///< Specific error metadata.
     YamlStandardTMDInfo m_pdfSetStdInfo;       ///< Specific standard PDF metadata.
     PDFErrInfo m_pdfErrInfo;                     ///< Processed error structure information.
-    std::map<unsigned, std::unique_ptr<PDF_t>> m_PDFSet_; ///< Map of created PDF member objects.
-    std::vector<unsigned int> m_createdPDFSetsMember; ///< (Currently unused) Tracks created members.
+    std::vector<std::atomic<PDF_t *>> m_PDFSet_; ///< Created members by member number, read lock-free.
+    std::vector<std::unique_ptr<PDF_t>> m_PDFSetOwner_; ///< Owns the members published in m_PDFSet_.
     IUncertainty m_uncertaintyStrategy_;         ///< The strategy object for uncertainty calculations.
     IQCDCoupling m_qcdCoupling; ///< The QCD coupling calculation object.
     double m_setCL;                              ///< The native confidence level of the set.
     bool m_alternativeReplicaUncertainty;      ///< Flag for replica uncertainty method.
     bool m_isValid = false;                      ///< Flag indicating if the set loaded correctly.
-    std::mutex m_pdfSetMtx;                      ///< Mutex for thread-safe creation of PDF members.
+    size_t m_maxThreads = 0;                     ///< Thread limit for member evaluation (0: pool size).
+    std::unique_ptr<std::mutex> m_pdfSetMtx =
+        std::make_unique<std::mutex>(); ///< Serializes creation of PDF members.
 };
 
 } // namespace PDFxTMD
\ No newline at end of file
@@ -0,0 +1,50 @@
+/// @file HessianKernels.h
+/// @brief Vectorized reductions shared by the Hessian and symmetric Hessian strategies.
+///
+/// All kernels work on a contiguous block of member values laid out as points x members: row `p`
+/// starts at `values + p * nMembers` and holds the central member followed by the error members.
+/// The AVX-512 or AVX2 implementation is selected at compile time from the target flags, with a
+/// scalar fallback for other targets.
+#pragma once
+#include <cstddef>
+
+namespace PDFxTMD
+{
+/**
+ * @brief Asymmetric Hessian quadrature sums, Eqs. (2.1), (2.2) and (2.6) of arXiv:1106.5788v2,
+ * before the square root is taken.
+ * @param values Block of nPoints x nMembers member values.
+ * @param nPoints Number of rows in the block.
+ * @param nMembers Row length of the block.
+ * @param nEigen Number of eigenvector pairs, members (2i-1, 2i) for i = 1..nEigen.
+ * @param errplus2 Output, sum of squared positive deviations per point.
+ * @param errminus2 Output, sum of squared negative deviations per point.
+ * @param errsymm2 Output, sum of squared pair differences per point.
+ */
+void HessianQuadratureSums(const double *values, size_t nPoints, size_t nMembers, size_t nEigen,
+                           double *errplus2, double *errminus2, double *errsymm2);
+
+/**
+ * @brief Symmetric Hessian quadrature sum, the squared deviation of members 1..nEigen from the
+ * central member.
+ * @param values Block of nPoints x nMembers member values.
+ * @param nPoints Number of rows in the block.
+ * @param nMembers Row length of the block.
+ * @param nEigen Number of eigenvector members.
+ * @param errsymm2 Output, sum of squared deviations per point.
+ */
+void SymmHessianQuadratureSums(const double *values, size_t nPoints, size_t nMembers,
+                               size_t nEigen, double *errsymm2);
+
+/**
+ * @brief Dot product of the eigenvector pair differences of two rows,
+ * sum_i (a[2i-1] - a[2i]) * (b[2i-1] - b[2i]), as used by Eq. (2.5) of arXiv:1106.5788.
+ */
+double HessianPairDifferenceDot(const double *valuesA, const double *valuesB, size_t nEigen);
+
+/**
+ * @brief Dot product of the deviations from the central member of two rows,
+ * sum_i (a[i] - a[0]) * (b[i] - b[0]).
+ */
+double SymmHessianDeviationDot(const double *valuesA, const double *valuesB, size_t nEigen);
+} // namespace PDFxTMD
@@ -17,5 +17,18 @@ class SymmHessianStrategy
                      PDFUncertainty &uncertainty);
     double Correlation(const std::vector<double> &valuesA, const std::vector<double> &valuesB,
                        const int numCoreErrMember);
+
+    /// @brief Calculate the uncertainties of many points at once.
+    /// @param values Block of nPoints x members values; row p holds all members at point p.
+    /// @param nPoints Number of points (rows) in the block.
+    /// @param uncertainties Output, resized to nPoints.
+    void Uncertainty(const std::vector<double> &values, size_t nPoints,
+                     const int numCoreErrMember, const double cl,
+                     std::vector<PDFUncertainty> &uncertainties);
+    /// @brief Calculate the correlation between row p of valuesA and row p of valuesB for every
+    /// point p of two nPoints x members blocks.
+    void Correlation(const std::vector<double> &valuesA, const std::vector<double> &valuesB,
+                     size_t nPoints, const int numCoreErrMember,
+                     std::vector<double> &correlations);
 };
 } // namespace PDFxTMD
@@ -0,0 +1,122 @@
+/**
+ * @file pdfxtmd.h
+ * @brief C interface to PDFxTMDLib for C and foreign-function consumers.
+ *
+ * Sets, members and couplings are opaque handles. Every function that can fail returns a
+ * pdfxtmd_status; on failure pdfxtmd_last_error() describes what went wrong, and outputs are
+ * left unspecified. No C++ exception crosses this interface.
+ *
+ * Evaluation functions take n points as parallel arrays and fill @p output, so a single call
+ * reaches the batch paths of the library; a single point is n = 1. Arrays of all flavors hold
+ * PDFXTMD_NUM_FLAVORS values per point, ordered as pid -6 to 6 with the gluon in the middle.
+ *
+ * Handles may be shared between threads for evaluation. A member obtained from a set belongs to
+ * the set and stays valid until the set is closed.
+ */
+#ifndef PDFXTMD_C_API_H
+#define PDFXTMD_C_API_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Number of values per point filled by the all-flavor functions */
+#define PDFXTMD_NUM_FLAVORS 13
+
+typedef enum pdfxtmd_status
+{
+    PDFXTMD_OK = 0,
+    /** A handle or array argument is NULL */
+    PDFXTMD_ERROR_NULL_ARGUMENT = 1,
+    /** An argument is out of range, e.g. a member index or a confidence level */
+    PDFXTMD_ERROR_INVALID_INPUT = 2,
+    /** A set or one of its files could not be found or read */
+    PDFXTMD_ERROR_FILE = 3,
+    /** A data or info file is malformed */
+    PDFXTMD_ERROR_FORMAT = 4,
+    /** The set asks for a feature the library does not support */
+    PDFXTMD_ERROR_NOT_SUPPORTED = 5,
+    PDFXTMD_ERROR_OUT_OF_MEMORY = 6,
+    /** Any other failure */
+    PDFXTMD_ERROR_INTERNAL = 7
+} pdfxtmd_status;
+
+typedef struct pdfxtmd_cpdf_set pdfxtmd_cpdf_set;
+typedef struct pdfxtmd_tmd_set pdfxtmd_tmd_set;
+typedef struct pdfxtmd_cpdf pdfxtmd_cpdf;
+typedef struct pdfxtmd_tmd pdfxtmd_tmd;
+typedef struct pdfxtmd_coupling pdfxtmd_coupling;
+
+/** Central value and uncertainties of a PDF set at one point, as PDFxTMD::PDFUncertainty */
+typedef struct pdfxtmd_uncertainty
+{
+    double central, errplus, errminus, errsymm, scale;
+    double errplus_pdf, errminus_pdf, errsymm_pdf;
+    double errplus_par, errminus_par, errsymm_par;
+} pdfxtmd_uncertainty;
+
+/** Library version as "major.minor.patch" */
+const char *pdfxtmd_version(void);
+
+/** Message of the last failed call on this thread; empty if none failed */
+const char *pdfxtmd_last_error(void);
+
+/* Collinear PDF sets. A negative cl selects the confidence level of the set. */
+pdfxtmd_status pdfxtmd_cpdf_set_open(const char *name, pdfxtmd_cpdf_set **set);
+void pdfxtmd_cpdf_set_close(pdfxtmd_cpdf_set *set);
+pdfxtmd_status pdfxtmd_cpdf_set_size(const pdfxtmd_cpdf_set *set, size_t *size);
+/** Member @p member of the set; all members are loaded when the set is opened */
+pdfxtmd_status pdfxtmd_cpdf_set_member(pdfxtmd_cpdf_set *set, int member,
+                                       const pdfxtmd_cpdf **pdf);
+pdfxtmd_status pdfxtmd_cpdf_set_alphas_q2(const pdfxtmd_cpdf_set *set, const double *q2,
+                                          double *alphas, size_t n);
+pdfxtmd_status pdfxtmd_cpdf_set_uncertainty(pdfxtmd_cpdf_set *set, int flavor, const double *x,
+                                            const double *mu2, size_t n, double cl,
+                                            pdfxtmd_uncertainty *output);
+
+/* TMD sets. A negative cl selects the confidence level of the set. */
+pdfxtmd_status pdfxtmd_tmd_set_open(const char *name, pdfxtmd_tmd_set **set);
+void pdfxtmd_tmd_set_close(pdfxtmd_tmd_set *set);
+pdfxtmd_status pdfxtmd_tmd_set_size(const pdfxtmd_tmd_set *set, size_t *size);
+/** Member @p member of the set; all members are loaded when the set is opened */
+pdfxtmd_status pdfxtmd_tmd_set_member(pdfxtmd_tmd_set *set, int member, const pdfxtmd_tmd **pdf);
+pdfxtmd_status pdfxtmd_tmd_set_alphas_q2(const pdfxtmd_tmd_set *set, const double *q2,
+                                         double *alphas, size_t n);
+pdfxtmd_status pdfxtmd_tmd_set_uncertainty(pdfxtmd_tmd_set *set, int flavor, const double *x,
+                                           const double *kt2, const double *mu2, size_t n,
+                                           double cl, pdfxtmd_uncertainty *output);
+
+/* Single members, outside of a set. Only members opened here are closed by the caller. */
+pdfxtmd_status pdfxtmd_cpdf_open(const char *name, int member, pdfxtmd_cpdf **pdf);
+void pdfxtmd_cpdf_close(pdfxtmd_cpdf *pdf);
+/** output[i] = xf(flavor, x[i], mu2[i]) for i < n */
+pdfxtmd_status pdfxtmd_cpdf_eval(const pdfxtmd_cpdf *pdf, int flavor, const double *x,
+                                 const double *mu2, double *output, size_t n);
+/** All flavors at n points into output[PDFXTMD_NUM_FLAVORS * n] */
+pdfxtmd_status pdfxtmd_cpdf_eval_all(const pdfxtmd_cpdf *pdf, const double *x, const double *mu2,
+                                     double *output, size_t n);
+
+pdfxtmd_status pdfxtmd_tmd_open(const char *name, int member, pdfxtmd_tmd **pdf);
+void pdfxtmd_tmd_close(pdfxtmd_tmd *pdf);
+/** output[i] = xf(flavor, x[i], kt2[i], mu2[i]) for i < n */
+pdfxtmd_status pdfxtmd_tmd_eval(const pdfxtmd_tmd *pdf, int flavor, const double *x,
+                                const double *kt2, const double *mu2, double *output, size_t n);
+/** All flavors at n points into output[PDFXTMD_NUM_FLAVORS * n] */
+pdfxtmd_status pdfxtmd_tmd_eval_all(const pdfxtmd_tmd *pdf, const double *x, const double *kt2,
+                                    const double *mu2, double *output, size_t n);
+
+/* Strong couplings, built from the alpha_s metadata of a set */
+pdfxtmd_status pdfxtmd_coupling_open(const char *name, pdfxtmd_coupling **coupling);
+void pdfxtmd_coupling_close(pdfxtmd_coupling *coupling);
+/** alphas[i] = alpha_s(q2[i]) for i < n */
+pdfxtmd_status pdfxtmd_coupling_alphas_q2(const pdfxtmd_coupling *coupling, const double *q2,
+                                          double *alphas, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PDFXTMD_C_API_H */
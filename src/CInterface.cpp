@@ -0,0 +1,298 @@
+#include "PDFxTMDLib/pdfxtmd.h"
+#include "PDFxTMDLib/PDFSet.h"
+#include <PDFxTMDLib/Common/Exception.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "CInterfaceGuard.h"
+
+namespace
+{
+using namespace PDFxTMD;
+using CPDFSet = PDFSet<CollinearPDFTag>;
+using TMDSet = PDFSet<TMDPDFTag>;
+using AllFlavors = std::array<double, DEFAULT_TOTAL_PDFS>;
+static_assert(DEFAULT_TOTAL_PDFS == PDFXTMD_NUM_FLAVORS, "pdfxtmd.h and the library disagree on "
+                                                         "the number of flavors");
+static_assert(sizeof(AllFlavors) == DEFAULT_TOTAL_PDFS * sizeof(double),
+              "Arrays of all flavors are read as std::array");
+static_assert(sizeof(pdfxtmd_uncertainty) == 11 * sizeof(double),
+              "pdfxtmd_uncertainty holds the scalars of PDFUncertainty");
+
+thread_local std::string t_lastError;
+
+// The handles are never defined; they are the library objects behind an opaque type.
+const CPDFSet *Unwrap(const pdfxtmd_cpdf_set *set)
+{
+    return reinterpret_cast<const CPDFSet *>(set);
+}
+CPDFSet *Unwrap(pdfxtmd_cpdf_set *set)
+{
+    return reinterpret_cast<CPDFSet *>(set);
+}
+const TMDSet *Unwrap(const pdfxtmd_tmd_set *set)
+{
+    return reinterpret_cast<const TMDSet *>(set);
+}
+TMDSet *Unwrap(pdfxtmd_tmd_set *set)
+{
+    return reinterpret_cast<TMDSet *>(set);
+}
+const ICPDF *Unwrap(const pdfxtmd_cpdf *pdf)
+{
+    return reinterpret_cast<const ICPDF *>(pdf);
+}
+const ITMD *Unwrap(const pdfxtmd_tmd *pdf)
+{
+    return reinterpret_cast<const ITMD *>(pdf);
+}
+const IQCDCoupling *Unwrap(const pdfxtmd_coupling *coupling)
+{
+    return reinterpret_cast<const IQCDCoupling *>(coupling);
+}
+
+void CopyUncertainties(const std::vector<PDFUncertainty> &uncertainties,
+                       pdfxtmd_uncertainty *output)
+{
+    for (size_t i = 0; i < uncertainties.size(); ++i)
+    {
+        const PDFUncertainty &u = uncertainties[i];
+        output[i] = {u.central,     u.errplus,      u.errminus,    u.errsymm,
+                     u.scale,       u.errplus_pdf,  u.errminus_pdf, u.errsymm_pdf,
+                     u.errplus_par, u.errminus_par, u.errsymm_par};
+    }
+}
+} // namespace
+
+namespace PDFxTMD
+{
+void SetLastError(const char *function, const char *message) noexcept
+{
+    try
+    {
+        t_lastError = std::string(function) + ": " + message;
+    }
+    catch (...)
+    {
+        t_lastError.clear();
+    }
+}
+} // namespace PDFxTMD
+
+extern "C"
+{
+    const char *pdfxtmd_version(void)
+    {
+        return PROJECT_VERSION;
+    }
+
+    const char *pdfxtmd_last_error(void)
+    {
+        return t_lastError.c_str();
+    }
+
+    // Collinear PDF sets
+    pdfxtmd_status pdfxtmd_cpdf_set_open(const char *name, pdfxtmd_cpdf_set **set)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(name, 1, {set});
+            *set = reinterpret_cast<pdfxtmd_cpdf_set *>(new CPDFSet(name));
+        });
+    }
+
+    void pdfxtmd_cpdf_set_close(pdfxtmd_cpdf_set *set)
+    {
+        delete Unwrap(set);
+    }
+
+    pdfxtmd_status pdfxtmd_cpdf_set_size(const pdfxtmd_cpdf_set *set, size_t *size)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, 1, {size});
+            *size = Unwrap(set)->size();
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_cpdf_set_member(pdfxtmd_cpdf_set *set, int member,
+                                           const pdfxtmd_cpdf **pdf)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, 1, {pdf});
+            *pdf = reinterpret_cast<const pdfxtmd_cpdf *>((*Unwrap(set))[member]);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_cpdf_set_alphas_q2(const pdfxtmd_cpdf_set *set, const double *q2,
+                                              double *alphas, size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, n, {q2, alphas});
+            Unwrap(set)->alphasQ2(q2, alphas, n);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_cpdf_set_uncertainty(pdfxtmd_cpdf_set *set, int flavor,
+                                                const double *x, const double *mu2, size_t n,
+                                                double cl, pdfxtmd_uncertainty *output)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, n, {x, mu2, output});
+            std::vector<PDFUncertainty> uncertainties;
+            Unwrap(set)->Uncertainty(static_cast<PartonFlavor>(flavor), x, mu2, n, cl,
+                                     uncertainties);
+            CopyUncertainties(uncertainties, output);
+        });
+    }
+
+    // TMD sets
+    pdfxtmd_status pdfxtmd_tmd_set_open(const char *name, pdfxtmd_tmd_set **set)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(name, 1, {set});
+            *set = reinterpret_cast<pdfxtmd_tmd_set *>(new TMDSet(name));
+        });
+    }
+
+    void pdfxtmd_tmd_set_close(pdfxtmd_tmd_set *set)
+    {
+        delete Unwrap(set);
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_set_size(const pdfxtmd_tmd_set *set, size_t *size)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, 1, {size});
+            *size = Unwrap(set)->size();
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_set_member(pdfxtmd_tmd_set *set, int member,
+                                          const pdfxtmd_tmd **pdf)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, 1, {pdf});
+            *pdf = reinterpret_cast<const pdfxtmd_tmd *>((*Unwrap(set))[member]);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_set_alphas_q2(const pdfxtmd_tmd_set *set, const double *q2,
+                                             double *alphas, size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, n, {q2, alphas});
+            Unwrap(set)->alphasQ2(q2, alphas, n);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_set_uncertainty(pdfxtmd_tmd_set *set, int flavor,
+                                               const double *x, const double *kt2,
+                                               const double *mu2, size_t n, double cl,
+                                               pdfxtmd_uncertainty *output)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(set, n, {x, kt2, mu2, output});
+            std::vector<PDFUncertainty> uncertainties;
+            Unwrap(set)->Uncertainty(static_cast<PartonFlavor>(flavor), x, kt2, mu2, n, cl,
+                                     uncertainties);
+            CopyUncertainties(uncertainties, output);
+        });
+    }
+
+    // Single members
+    pdfxtmd_status pdfxtmd_cpdf_open(const char *name, int member, pdfxtmd_cpdf **pdf)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(name, 1, {pdf});
+            *pdf = reinterpret_cast<pdfxtmd_cpdf *>(
+                new ICPDF(GenericCPDFFactory().mkCPDF(name, member)));
+        });
+    }
+
+    void pdfxtmd_cpdf_close(pdfxtmd_cpdf *pdf)
+    {
+        delete Unwrap(pdf);
+    }
+
+    pdfxtmd_status pdfxtmd_cpdf_eval(const pdfxtmd_cpdf *pdf, int flavor, const double *x,
+                                     const double *mu2, double *output, size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(pdf, n, {x, mu2, output});
+            const ICPDF *cpdf = Unwrap(pdf);
+            const auto parton = static_cast<PartonFlavor>(flavor);
+            for (size_t i = 0; i < n; ++i)
+                output[i] = cpdf->pdf(parton, x[i], mu2[i]);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_cpdf_eval_all(const pdfxtmd_cpdf *pdf, const double *x,
+                                         const double *mu2, double *output, size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(pdf, n, {x, mu2, output});
+            const ICPDF *cpdf = Unwrap(pdf);
+            auto *points = reinterpret_cast<AllFlavors *>(output);
+            for (size_t i = 0; i < n; ++i)
+                cpdf->pdf(x[i], mu2[i], points[i]);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_open(const char *name, int member, pdfxtmd_tmd **pdf)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(name, 1, {pdf});
+            *pdf = reinterpret_cast<pdfxtmd_tmd *>(
+                new ITMD(GenericTMDFactory().mkTMD(name, member)));
+        });
+    }
+
+    void pdfxtmd_tmd_close(pdfxtmd_tmd *pdf)
+    {
+        delete Unwrap(pdf);
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_eval(const pdfxtmd_tmd *pdf, int flavor, const double *x,
+                                    const double *kt2, const double *mu2, double *output,
+                                    size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(pdf, n, {x, kt2, mu2, output});
+            Unwrap(pdf)->tmd(static_cast<PartonFlavor>(flavor), x, kt2, mu2, output, n);
+        });
+    }
+
+    pdfxtmd_status pdfxtmd_tmd_eval_all(const pdfxtmd_tmd *pdf, const double *x,
+                                        const double *kt2, const double *mu2, double *output,
+                                        size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(pdf, n, {x, kt2, mu2, output});
+            Unwrap(pdf)->tmd(x, kt2, mu2, reinterpret_cast<AllFlavors *>(output), n);
+        });
+    }
+
+    // Strong couplings
+    pdfxtmd_status pdfxtmd_coupling_open(const char *name, pdfxtmd_coupling **coupling)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(name, 1, {coupling});
+            *coupling = reinterpret_cast<pdfxtmd_coupling *>(
+                new IQCDCoupling(CouplingFactory().mkCoupling(name)));
+        });
+    }
+
+    void pdfxtmd_coupling_close(pdfxtmd_coupling *coupling)
+    {
+        delete Unwrap(coupling);
+    }
+
+    pdfxtmd_status pdfxtmd_coupling_alphas_q2(const pdfxtmd_coupling *coupling, const double *q2,
+                                              double *alphas, size_t n)
+    {
+        return Guard(__func__, [&] {
+            CheckArguments(coupling, n, {q2, alphas});
+            Unwrap(coupling)->AlphaQCDMu2(q2, alphas, n);
+        });
+    }
+}
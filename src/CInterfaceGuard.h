@@ -0,0 +1,105 @@
+// Internal to the library sources; not installed.
+#pragma once
+#include "PDFxTMDLib/Common/Exception.h"
+#include "PDFxTMDLib/pdfxtmd.h"
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace PDFxTMD
+{
+class NullArgumentError : public PDFxTMDException
+{
+  public:
+    explicit NullArgumentError(const std::string &message) : PDFxTMDException(message)
+    {
+    }
+};
+
+/// Throws NullArgumentError if @p handle is null, or one of @p arrays is while n > 0
+inline void CheckArguments(const void *handle, size_t n,
+                           std::initializer_list<const void *> arrays = {})
+{
+    bool hasNull = handle == nullptr;
+    for (const void *array : arrays)
+        hasNull = hasNull || (n > 0 && array == nullptr);
+    if (hasNull)
+        throw NullArgumentError("NULL handle or array argument");
+}
+
+/// Stores "function: message" as the message of pdfxtmd_last_error on this thread
+void SetLastError(const char *function, const char *message) noexcept;
+
+/// Runs @p body, turning the exceptions it throws into status codes and a message prefixed
+/// with @p function. Shared by the C and the Fortran interface, so no exception leaves either.
+template <typename Body> pdfxtmd_status Guard(const char *function, Body &&body) noexcept
+{
+    const auto Fail = [function](pdfxtmd_status status, const char *message) {
+        SetLastError(function, message);
+        return status;
+    };
+    try
+    {
+        body();
+        return PDFXTMD_OK;
+    }
+    catch (const NullArgumentError &error)
+    {
+        return Fail(PDFXTMD_ERROR_NULL_ARGUMENT, error.what());
+    }
+    catch (const FileLoadException &error)
+    {
+        return Fail(PDFXTMD_ERROR_FILE, error.what());
+    }
+    catch (const InvalidFormatException &error)
+    {
+        return Fail(PDFXTMD_ERROR_FORMAT, error.what());
+    }
+    catch (const InvalidInfoFile &error)
+    {
+        return Fail(PDFXTMD_ERROR_FORMAT, error.what());
+    }
+    catch (const MetadataError &error)
+    {
+        return Fail(PDFXTMD_ERROR_FORMAT, error.what());
+    }
+    catch (const NotSupportError &error)
+    {
+        return Fail(PDFXTMD_ERROR_NOT_SUPPORTED, error.what());
+    }
+    catch (const NotImplementedError &error)
+    {
+        return Fail(PDFXTMD_ERROR_NOT_SUPPORTED, error.what());
+    }
+    catch (const InvalidInputError &error)
+    {
+        return Fail(PDFXTMD_ERROR_INVALID_INPUT, error.what());
+    }
+    catch (const OutOfRangeExcecption &error)
+    {
+        return Fail(PDFXTMD_ERROR_INVALID_INPUT, error.what());
+    }
+    catch (const std::invalid_argument &error)
+    {
+        return Fail(PDFXTMD_ERROR_INVALID_INPUT, error.what());
+    }
+    catch (const std::out_of_range &error)
+    {
+        return Fail(PDFXTMD_ERROR_INVALID_INPUT, error.what());
+    }
+    catch (const std::bad_alloc &)
+    {
+        return Fail(PDFXTMD_ERROR_OUT_OF_MEMORY, "Out of memory");
+    }
+    catch (const std::exception &error)
+    {
+        return Fail(PDFXTMD_ERROR_INTERNAL, error.what());
+    }
+    catch (...)
+    {
+        return Fail(PDFXTMD_ERROR_INTERNAL, "Unknown error");
+    }
+}
+} // namespace PDFxTMD
@@ -0,0 +1,23 @@
+/* Compiles pdfxtmd.h as strict C, so the C interface stays usable from C. Not part of the
+ * library; the function below only has to compile. */
+#include "PDFxTMDLib/pdfxtmd.h"
+
+pdfxtmd_status pdfxtmd_header_check(const char *name)
+{
+    pdfxtmd_cpdf_set *set = NULL;
+    const pdfxtmd_cpdf *pdf = NULL;
+    pdfxtmd_uncertainty uncertainty;
+    double x = 1e-3, mu2 = 100, values[PDFXTMD_NUM_FLAVORS];
+    size_t size = 0;
+    pdfxtmd_status status = pdfxtmd_cpdf_set_open(name, &set);
+    if (status == PDFXTMD_OK)
+        status = pdfxtmd_cpdf_set_size(set, &size);
+    if (status == PDFXTMD_OK)
+        status = pdfxtmd_cpdf_set_member(set, 0, &pdf);
+    if (status == PDFXTMD_OK)
+        status = pdfxtmd_cpdf_eval_all(pdf, &x, &mu2, values, 1);
+    if (status == PDFXTMD_OK)
+        status = pdfxtmd_cpdf_set_uncertainty(set, 21, &x, &mu2, 1, -1, &uncertainty);
+    pdfxtmd_cpdf_set_close(set);
+    return status;
+}
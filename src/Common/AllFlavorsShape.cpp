@@ -76,7 +76,9 @@ void DefaultAllFlavorShape::initPidLookup()
     {
         _lookup[i + 6] = findPidInPids(i, _pids);
     }
-    _lookup[0 + 6] = findPidInPids(21, _pids);  // Gluon (21) mapped to index 6
+    // Gluon (21) mapped to index 6, falling back to a gluon stored as 0
+    if (findPidInPids(21, _pids) != -1)
+        _lookup[0 + 6] = findPidInPids(21, _pids);
     _lookup[13 + 6] = findPidInPids(22, _pids); // Photon (22) mapped to index 19
 }
 
@@ -141,6 +143,17 @@ const double &DefaultAllFlavorShape::coeff(int ix, int iq2, int flavorId, int in
     return coefficients_flat[ix * n_mu2s * n_flavors * 4 + iq2 * n_flavors * 4 + flavorId * 4 + in];
 }
 
+size_t DefaultAllFlavorShape::memoryUsage() const
+{
+    auto bytes = [](const auto &vec) { return vec.capacity() * sizeof(vec[0]); };
+    size_t total = bytes(log_x_vec) + bytes(log_mu2_vec) + bytes(x_vec) + bytes(mu2_vec) +
+                   bytes(dlogx) + bytes(dlogq) + bytes(coefficients_flat) + bytes(grids_flat) +
+                   bytes(_shape) + bytes(_pids);
+    for (const auto &grid : grids)
+        total += bytes(grid.second);
+    return total;
+}
+
 void DefaultAllFlavorTMDShape::finalizeXKt2P2()
 {
     finalizeXP2();
@@ -151,6 +164,24 @@ void DefaultAllFlavorTMDShape::finalizeXKt2P2()
     {
         log_kt2_vec.push_back(std::log(kt2));
     }
+    initTMDLayout();
+}
+
+void DefaultAllFlavorTMDShape::initTMDLayout()
+{
+    n_xs = log_x_vec.size();
+    n_kt2s = log_kt2_vec.size();
+    n_mu2s = log_mu2_vec.size();
+    n_flavors = _pids.size();
+    stride_iq2 = n_flavors;
+    stride_ikt2 = n_mu2s * n_flavors;
+    stride_ix = n_kt2s * stride_ikt2;
+    initPidLookup();
 }
 
+size_t DefaultAllFlavorTMDShape::memoryUsage() const
+{
+    return DefaultAllFlavorShape::memoryUsage() +
+           (log_kt2_vec.capacity() + kt2_vec.capacity()) * sizeof(double);
+}
 } // namespace PDFxTMD
\ No newline at end of file
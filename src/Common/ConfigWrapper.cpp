@@ -2,6 +2,7 @@
 #include "PDFxTMDLib/external/rapidyaml/rapidyaml-0.9.0.hpp"
 #include "PDFxTMDLib/Common/ConfigWrapper.h"
 #include <filesystem>
+#include <mutex>
 
 namespace PDFxTMD
 {
@@ -98,4 +99,50 @@ bool ConfigWrapper::loadFromFile(const std::filesystem::path &filepath, Format f
     }
     return false;
 }
-} // namespace PDFxTMD
\ No newline at end of file
+
+namespace
+{
+struct CachedConfig
+{
+    std::filesystem::file_time_type modified;
+    std::uintmax_t size = 0;
+    std::shared_ptr<const ConfigWrapper> config;
+};
+std::mutex g_configCacheMtx;
+std::map<std::string, CachedConfig> g_configCache;
+} // namespace
+
+std::shared_ptr<const ConfigWrapper> ConfigWrapper::loadCached(const std::filesystem::path &filepath)
+{
+    std::error_code ec;
+    const auto modified = std::filesystem::last_write_time(filepath, ec);
+    const std::uintmax_t size = ec ? 0 : std::filesystem::file_size(filepath, ec);
+    if (ec)
+    {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_configCacheMtx);
+        auto it = g_configCache.find(filepath.string());
+        if (it != g_configCache.end() && it->second.modified == modified &&
+            it->second.size == size)
+        {
+            return it->second.config;
+        }
+    }
+    auto config = std::make_shared<ConfigWrapper>();
+    if (!config->loadFromFile(filepath, Format::YAML))
+    {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(g_configCacheMtx);
+    g_configCache[filepath.string()] = {modified, size, config};
+    return config;
+}
+
+void ConfigWrapper::clearCache()
+{
+    std::lock_guard<std::mutex> lock(g_configCacheMtx);
+    g_configCache.clear();
+}
+} // namespace PDFxTMD
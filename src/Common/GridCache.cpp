@@ -0,0 +1,149 @@
+#include "PDFxTMDLib/Common/GridCache.h"
+#include <cstdlib>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace PDFxTMD
+{
+namespace
+{
+constexpr size_t DefaultMemoryLimitMB = 1024;
+
+size_t memoryLimitFromEnvironment()
+{
+    if (const char *limit = std::getenv("PDFXTMD_GRID_CACHE_MB"))
+    {
+        char *end = nullptr;
+        unsigned long long mb = std::strtoull(limit, &end, 10);
+        if (end != limit)
+            return static_cast<size_t>(mb) * 1024 * 1024;
+    }
+    return DefaultMemoryLimitMB * 1024 * 1024;
+}
+} // namespace
+
+GridCache::GridCache() : m_limit(memoryLimitFromEnvironment())
+{
+}
+
+GridCache &GridCache::Global()
+{
+    static GridCache cache;
+    return cache;
+}
+
+std::shared_ptr<const void> GridCache::GetOrLoadImpl(const std::string &kind,
+                                                     const std::string &path,
+                                                     const std::function<Loaded()> &load)
+{
+    // Without a stable identity of the file there is nothing safe to share
+    std::error_code ec;
+    const fs::path canonicalPath = fs::canonical(path, ec);
+    if (ec || canonicalPath.empty())
+        return load().first;
+    const auto modified = fs::last_write_time(canonicalPath, ec);
+    if (ec)
+        return load().first;
+    const uintmax_t size = fs::file_size(canonicalPath, ec);
+    if (ec)
+        return load().first;
+
+    const Key key{kind, canonicalPath.string(), modified.time_since_epoch().count(), size};
+    std::unique_lock<std::mutex> lock(m_mtx);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        it->second.lastUse = ++m_tick;
+        auto grid = it->second.grid;
+        lock.unlock();
+        return grid.get();
+    }
+    // Older versions of the file are not handed out again
+    for (auto stale = m_entries.begin(); stale != m_entries.end();)
+    {
+        if (std::get<0>(stale->first) == kind && std::get<1>(stale->first) == std::get<1>(key))
+        {
+            m_bytes -= stale->second.bytes;
+            stale = m_entries.erase(stale);
+        }
+        else
+            ++stale;
+    }
+    std::promise<std::shared_ptr<const void>> promise;
+    Entry &entry = m_entries[key];
+    entry.grid = promise.get_future().share();
+    entry.lastUse = ++m_tick;
+    lock.unlock();
+
+    Loaded loaded;
+    try
+    {
+        loaded = load();
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+        lock.lock();
+        m_entries.erase(key);
+        throw;
+    }
+    promise.set_value(loaded.first);
+
+    lock.lock();
+    it = m_entries.find(key);
+    if (it != m_entries.end() && !it->second.ready)
+    {
+        it->second.bytes = loaded.second;
+        it->second.ready = true;
+        m_bytes += loaded.second;
+        EvictUnused();
+    }
+    return loaded.first;
+}
+
+void GridCache::EvictUnused()
+{
+    while (m_bytes > m_limit)
+    {
+        auto victim = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            // The shared state of the future holds the only reference of an unused grid
+            if (it->second.ready && it->second.grid.get().use_count() == 1 &&
+                (victim == m_entries.end() || it->second.lastUse < victim->second.lastUse))
+                victim = it;
+        }
+        if (victim == m_entries.end())
+            return;
+        m_bytes -= victim->second.bytes;
+        m_entries.erase(victim);
+    }
+}
+
+void GridCache::SetMemoryLimit(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_limit = bytes;
+    EvictUnused();
+}
+
+size_t GridCache::MemoryLimit() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_limit;
+}
+
+size_t GridCache::MemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_bytes;
+}
+
+void GridCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_entries.clear();
+    m_bytes = 0;
+}
+} // namespace PDFxTMD
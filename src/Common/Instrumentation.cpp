@@ -0,0 +1,209 @@
+#include "PDFxTMDLib/Common/Instrumentation.h"
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace PDFxTMD
+{
+namespace
+{
+struct Registry
+{
+    std::mutex mutex;
+    std::map<std::pair<std::string, int>, std::shared_ptr<PDFCounters>> pdfs;
+    PathCounters alphas;
+    PathCounters uncertainty;
+};
+
+// Never destroyed, so members and couplings destroyed at exit can still report
+Registry &GlobalRegistry()
+{
+    static Registry *registry = new Registry;
+    return *registry;
+}
+
+PathStatistics Copy(const PathCounters &path)
+{
+    return {path.calls.load(std::memory_order_relaxed),
+            path.sampledCalls.load(std::memory_order_relaxed),
+            path.sampledTicks.load(std::memory_order_relaxed)};
+}
+
+void Zero(PathCounters &path)
+{
+    path.calls = 0;
+    path.sampledCalls = 0;
+    path.sampledTicks = 0;
+}
+
+std::string Quoted(const std::string &text)
+{
+    std::string quoted = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void WritePath(std::ostream &os, const PathStatistics &path)
+{
+    os << "{\"calls\": " << path.calls << ", \"sampled_calls\": " << path.sampledCalls
+       << ", \"sampled_ticks\": " << path.sampledTicks
+       << ", \"ticks_per_call\": " << path.TicksPerCall() << "}";
+}
+
+#ifdef PDFXTMD_INSTRUMENTATION
+// Writes the statistics when the program ends. The registry and the Logger are created first,
+// so that they outlive this object.
+struct ExitReport
+{
+    ExitReport()
+    {
+        GlobalRegistry();
+        Logger::getInstance();
+    }
+    ~ExitReport()
+    {
+        try
+        {
+            if (const char *path = std::getenv("PDFXTMD_INSTRUMENTATION_FILE"))
+            {
+                std::ofstream file(path);
+                Instrumentation::WriteJSON(file);
+            }
+            else
+            {
+                std::ostringstream json;
+                Instrumentation::WriteJSON(json);
+                PDFxTMDLOG << json.str() << std::endl;
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+} exitReport;
+#endif
+} // namespace
+
+std::shared_ptr<PDFCounters> Instrumentation::Counters(const std::string &set, int member)
+{
+    Registry &registry = GlobalRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto &counters = registry.pdfs[{set, member}];
+    if (!counters)
+        counters = std::make_shared<PDFCounters>(set, member);
+    return counters;
+}
+
+PathCounters &Instrumentation::AlphaS()
+{
+    return GlobalRegistry().alphas;
+}
+
+PathCounters &Instrumentation::Uncertainty()
+{
+    return GlobalRegistry().uncertainty;
+}
+
+InstrumentationStatistics Instrumentation::Snapshot()
+{
+    InstrumentationStatistics statistics;
+#if defined(PDFXTMD_INSTRUMENTATION) &&                                                          \
+    (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+    statistics.tickUnit = "cycles";
+#else
+    statistics.tickUnit = "ns";
+#endif
+    Registry &registry = GlobalRegistry();
+    statistics.alphas = Copy(registry.alphas);
+    statistics.uncertainty = Copy(registry.uncertainty);
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto &entry : registry.pdfs)
+    {
+        const PDFCounters &counters = *entry.second;
+        PDFStatistics pdf;
+        pdf.set = counters.set;
+        pdf.member = counters.member;
+        for (size_t i = 0; i < pdf.paths.size(); ++i)
+            pdf.paths[i] = Copy(counters.paths[i]);
+        for (size_t i = 0; i < pdf.counters.size(); ++i)
+            pdf.counters[i] = counters.counters[i].load(std::memory_order_relaxed);
+        pdf.loads = counters.loads.load(std::memory_order_relaxed);
+        pdf.loadNanoseconds = counters.loadNanoseconds.load(std::memory_order_relaxed);
+        pdf.gridBytes = counters.gridBytes.load(std::memory_order_relaxed);
+        statistics.pdfs.push_back(std::move(pdf));
+    }
+    return statistics;
+}
+
+void Instrumentation::WriteJSON(std::ostream &os)
+{
+    const InstrumentationStatistics statistics = Snapshot();
+    os << "{\n  \"enabled\": " << (Enabled() ? "true" : "false")
+       << ",\n  \"tick_unit\": " << Quoted(statistics.tickUnit)
+       << ",\n  \"sampling_period\": " << statistics.samplingPeriod << ",\n  \"alphas\": ";
+    WritePath(os, statistics.alphas);
+    os << ",\n  \"uncertainty\": ";
+    WritePath(os, statistics.uncertainty);
+    os << ",\n  \"pdfs\": [";
+    for (size_t i = 0; i < statistics.pdfs.size(); ++i)
+    {
+        const PDFStatistics &pdf = statistics.pdfs[i];
+        os << (i ? ",\n" : "\n") << "    {\"set\": " << Quoted(pdf.set)
+           << ", \"member\": " << pdf.member << ", \"loads\": " << pdf.loads
+           << ", \"load_ns\": " << pdf.loadNanoseconds << ", \"grid_bytes\": " << pdf.gridBytes
+           << ",\n     \"interpolate\": ";
+        WritePath(os, pdf.path(InstrumentedPath::Interpolate));
+        os << ",\n     \"extrapolate\": ";
+        WritePath(os, pdf.path(InstrumentedPath::Extrapolate));
+        os << ",\n     \"interpolate_fallback\": "
+           << pdf.counter(InstrumentationCounter::InterpolateFallback)
+           << ",\n     \"continuation\": {\"small_x\": "
+           << pdf.counter(InstrumentationCounter::ContinuationSmallX)
+           << ", \"large_q2\": " << pdf.counter(InstrumentationCounter::ContinuationLargeQ2)
+           << ", \"small_x_large_q2\": "
+           << pdf.counter(InstrumentationCounter::ContinuationSmallXLargeQ2)
+           << ", \"small_q2_small_x\": "
+           << pdf.counter(InstrumentationCounter::ContinuationSmallQ2SmallX)
+           << ", \"small_q2\": " << pdf.counter(InstrumentationCounter::ContinuationSmallQ2)
+           << "}}";
+    }
+    os << (statistics.pdfs.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+void Instrumentation::Reset()
+{
+    Registry &registry = GlobalRegistry();
+    Zero(registry.alphas);
+    Zero(registry.uncertainty);
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto &entry : registry.pdfs)
+    {
+        PDFCounters &counters = *entry.second;
+        for (auto &path : counters.paths)
+            Zero(path);
+        for (auto &counter : counters.counters)
+            counter = 0;
+        counters.loads = 0;
+        counters.loadNanoseconds = 0;
+    }
+}
+
+PDFCounters *&Instrumentation::Current()
+{
+    thread_local PDFCounters *current = nullptr;
+    return current;
+}
+
+bool Instrumentation::Sample()
+{
+    thread_local uint64_t calls = 0;
+    return ++calls % PDFXTMD_INSTRUMENTATION_SAMPLING_PERIOD == 0;
+}
+} // namespace PDFxTMD
@@ -7,6 +7,8 @@
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <set>
 
 namespace fs = std::filesystem;
@@ -77,7 +79,9 @@ bool hasWriteAccess(const std::string &path)
         return false;
     }
 }
-std::vector<std::string> GetPDFxTMDPathsAsVector()
+namespace
+{
+std::vector<std::string> ResolvePDFxTMDPaths()
 {
     auto notDefaultPaths = GetPDFxTMDPathsFromYaml();
     if (!FileUtils::Exists(DEFAULT_ENV_PATH))
@@ -103,6 +107,98 @@ std::vector<std::string> GetPDFxTMDPathsAsVector()
     return std::vector(result.begin(), result.end());
 }
 
+std::string PDFxTMDRootPath()
+{
+#if defined(_WIN32)
+    return "C:/ProgramData/PDFxTMDLib";
+#else
+    const char *homeDir = std::getenv("HOME");
+    if (!homeDir)
+    {
+        return "";
+    }
+    return std::string(homeDir) + "/.PDFxTMDLib";
+#endif
+}
+
+// Search paths and the files already found in them. Resolving the paths reads config.yaml and
+// probes the directories for write access, so it is only redone when the working directory or
+// config.yaml changes. A set or member file that was found once is not searched for again while
+// it still exists; a removed file is searched for anew, e.g. after a set was reinstalled.
+struct PathCache
+{
+    std::mutex mtx;
+    bool valid = false;
+    std::string currentPath;
+    std::filesystem::file_time_type configModified;
+    std::uintmax_t configSize = 0;
+    std::vector<std::string> paths;
+    std::map<std::string, std::string> infoFiles;
+    std::map<std::pair<std::string, int>, std::string> memberFiles;
+};
+
+PathCache &GetPathCache()
+{
+    static PathCache cache;
+    return cache;
+}
+
+std::pair<std::filesystem::file_time_type, std::uintmax_t> ConfigFileStamp()
+{
+    const std::string rootPath = PDFxTMDRootPath();
+    if (rootPath.empty())
+    {
+        return {};
+    }
+    std::error_code ec;
+    const std::string configFilePath = rootPath + "/config.yaml";
+    auto modified = std::filesystem::last_write_time(configFilePath, ec);
+    if (ec)
+    {
+        return {};
+    }
+    return {modified, std::filesystem::file_size(configFilePath, ec)};
+}
+
+// Requires cache.mtx to be held
+void RefreshPathCache(PathCache &cache)
+{
+    std::error_code ec;
+    std::string currentPath = std::filesystem::current_path(ec).string();
+    auto [configModified, configSize] = ConfigFileStamp();
+    if (cache.valid && cache.currentPath == currentPath &&
+        cache.configModified == configModified && cache.configSize == configSize)
+    {
+        return;
+    }
+    cache.paths = ResolvePDFxTMDPaths();
+    cache.infoFiles.clear();
+    cache.memberFiles.clear();
+    cache.currentPath = currentPath;
+    // Resolving creates config.yaml if it is missing
+    std::tie(cache.configModified, cache.configSize) = ConfigFileStamp();
+    cache.valid = true;
+}
+} // namespace
+
+std::vector<std::string> GetPDFxTMDPathsAsVector()
+{
+    auto &cache = GetPathCache();
+    std::lock_guard<std::mutex> lock(cache.mtx);
+    RefreshPathCache(cache);
+    return cache.paths;
+}
+
+void ClearPathCache()
+{
+    auto &cache = GetPathCache();
+    std::lock_guard<std::mutex> lock(cache.mtx);
+    cache.valid = false;
+    cache.paths.clear();
+    cache.infoFiles.clear();
+    cache.memberFiles.clear();
+}
+
 std::vector<std::string> split(const std::string &str, char delimiter)
 {
     std::vector<std::string> tokens;
@@ -123,14 +219,25 @@ std::string to_str_zeropad(int val, size_t nchars)
 std::pair<std::optional<std::string>, ErrorType> StandardPDFSetPath(const std::string &pdfSetName,
                                                                     int set)
 {
-    auto pdfPaths = GetPDFxTMDPathsAsVector();
-    if (pdfPaths.size() == 0)
+    auto &cache = GetPathCache();
+    std::lock_guard<std::mutex> lock(cache.mtx);
+    RefreshPathCache(cache);
+    auto found = cache.memberFiles.find({pdfSetName, set});
+    if (found != cache.memberFiles.end())
+    {
+        if (fs::exists(found->second))
+        {
+            return {found->second, ErrorType::None};
+        }
+        cache.memberFiles.erase(found);
+    }
+    if (cache.paths.size() == 0)
     {
         return {"", ErrorType::FILE_NOT_FOUND};
     }
     fs::path pdfPath_;
     std::string memname = pdfSetName + "_" + to_str_zeropad(set) + STD_PDF_DATA_EXTENSION;
-    for (auto &&pdfPath : pdfPaths)
+    for (auto &&pdfPath : cache.paths)
     {
         pdfPath_ = pdfPath + FOLDER_SEP + pdfSetName + FOLDER_SEP + memname;
         if (!fs::exists(pdfPath_))
@@ -138,19 +245,31 @@ std::pair<std::optional<std::string>, ErrorType> StandardPDFSetPath(const std::s
             continue;
         }
 
+        cache.memberFiles[{pdfSetName, set}] = pdfPath_.string();
         return {pdfPath_.string(), ErrorType::None};
     }
     return {"", ErrorType::FILE_NOT_FOUND};
 }
 std::pair<std::optional<std::string>, ErrorType> StandardInfoFilePath(const std::string &pdfSetName)
 {
-    auto pdfPaths = GetPDFxTMDPathsAsVector();
-    if (pdfPaths.size() == 0)
+    auto &cache = GetPathCache();
+    std::lock_guard<std::mutex> lock(cache.mtx);
+    RefreshPathCache(cache);
+    auto found = cache.infoFiles.find(pdfSetName);
+    if (found != cache.infoFiles.end())
+    {
+        if (fs::exists(found->second))
+        {
+            return {found->second, ErrorType::None};
+        }
+        cache.infoFiles.erase(found);
+    }
+    if (cache.paths.size() == 0)
     {
         return {"", ErrorType::FILE_NOT_FOUND};
     }
     fs::path pdfPath_;
-    for (auto &&pdfPath : pdfPaths)
+    for (auto &&pdfPath : cache.paths)
     {
         pdfPath_ =
             pdfPath + FOLDER_SEP + pdfSetName + FOLDER_SEP + pdfSetName + STD_PDF_INFO_EXTENSION;
@@ -159,6 +278,7 @@ std::pair<std::optional<std::string>, ErrorType> StandardInfoFilePath(const std:
             continue;
         }
 
+        cache.infoFiles[pdfSetName] = pdfPath_.string();
         return {pdfPath_.string(), ErrorType::None};
     }
     return {"", ErrorType::FILE_NOT_FOUND};
@@ -182,18 +302,11 @@ double _extrapolateLinear(double x, double xl, double xh, double yl, double yh)
 
 std::vector<std::string> GetPDFxTMDPathsFromYaml()
 {
-    std::string rootPath;
-#if defined(_WIN32)
-    rootPath = "C:/ProgramData/PDFxTMDLib";
-#else
-
-    const char *homeDir = std::getenv("HOME");
-    if (!homeDir)
+    std::string rootPath = PDFxTMDRootPath();
+    if (rootPath.empty())
     {
         return {};
     }
-    rootPath = std::string(homeDir) + "/.PDFxTMDLib";
-#endif
     std::string configFilePath = rootPath + "/config.yaml";
     if (!std::filesystem::exists(rootPath) && !std::filesystem::create_directories(rootPath))
     {
@@ -214,23 +327,31 @@ std::vector<std::string> GetPDFxTMDPathsFromYaml()
     config.loadFromFile(configFilePath, PDFxTMD::ConfigWrapper::Format::YAML);
 
     auto pathsPair = config.get<std::vector<std::string>>("paths");
-    return *pathsPair.first;
+    if (pathsPair.first)
+    {
+        return *pathsPair.first;
+    }
+    // A single string holds the paths separated by '|'; an empty "paths:" holds none
+    auto pathPair = config.get<std::string>("paths");
+    std::vector<std::string> paths;
+    if (pathPair.first)
+    {
+        for (auto &&path : split(*pathPair.first, '|'))
+        {
+            if (!path.empty())
+                paths.push_back(path);
+        }
+    }
+    return paths;
 }
 
 bool AddPathToEnvironment(const std::string &newPath)
 {
-    std::string rootPath;
-#if defined(_WIN32)
-    rootPath = "C:/ProgramData/PDFxTMDLib";
-#else
-
-    const char *homeDir = std::getenv("HOME");
-    if (!homeDir)
+    std::string rootPath = PDFxTMDRootPath();
+    if (rootPath.empty())
     {
         return false;
     }
-    rootPath = std::string(homeDir) + "/.PDFxTMDLib";
-#endif
     auto updatedPaths = GetPDFxTMDPathsFromYaml();
     auto found_pathItr =
         std::find_if(updatedPaths.begin(), updatedPaths.end(),
@@ -241,7 +362,9 @@ bool AddPathToEnvironment(const std::string &newPath)
         updatedPaths.push_back(newPath);
         config.set("paths", updatedPaths);
         std::string configFilePath = rootPath + "/config.yaml";
-        return config.saveToFile(configFilePath);
+        bool saved = config.saveToFile(configFilePath);
+        ClearPathCache();
+        return saved;
     }
     return true;
 }
@@ -0,0 +1,148 @@
+// Internal to the library sources; not installed.
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
+
+namespace PDFxTMD
+{
+namespace
+{
+// Thin wrappers over one SIMD register for the batch kernels. `unpackLo`/`unpackHi` split two
+// consecutive loads of interleaved pairs into their even and odd members, in an order that only
+// suits reductions. The width follows the instruction set the including file is compiled for,
+// hence the internal linkage.
+#if defined(__AVX512F__)
+struct SimdD
+{
+    static constexpr size_t width = 8;
+    __m512d v;
+    static SimdD load(const double *p)
+    {
+        return {_mm512_loadu_pd(p)};
+    }
+    static SimdD set1(double x)
+    {
+        return {_mm512_set1_pd(x)};
+    }
+    void store(double *p) const
+    {
+        _mm512_storeu_pd(p, v);
+    }
+    static SimdD unpackLo(SimdD a, SimdD b)
+    {
+        return {_mm512_unpacklo_pd(a.v, b.v)};
+    }
+    static SimdD unpackHi(SimdD a, SimdD b)
+    {
+        return {_mm512_unpackhi_pd(a.v, b.v)};
+    }
+    friend SimdD operator-(SimdD a, SimdD b)
+    {
+        return {_mm512_sub_pd(a.v, b.v)};
+    }
+    friend SimdD max(SimdD a, SimdD b)
+    {
+        return {_mm512_max_pd(a.v, b.v)};
+    }
+    friend SimdD fma(SimdD a, SimdD b, SimdD c)
+    {
+        return {_mm512_fmadd_pd(a.v, b.v, c.v)};
+    }
+    double sum() const
+    {
+        return _mm512_reduce_add_pd(v);
+    }
+};
+#elif defined(__AVX2__) && defined(__FMA__)
+struct SimdD
+{
+    static constexpr size_t width = 4;
+    __m256d v;
+    static SimdD load(const double *p)
+    {
+        return {_mm256_loadu_pd(p)};
+    }
+    static SimdD set1(double x)
+    {
+        return {_mm256_set1_pd(x)};
+    }
+    void store(double *p) const
+    {
+        _mm256_storeu_pd(p, v);
+    }
+    static SimdD unpackLo(SimdD a, SimdD b)
+    {
+        return {_mm256_unpacklo_pd(a.v, b.v)};
+    }
+    static SimdD unpackHi(SimdD a, SimdD b)
+    {
+        return {_mm256_unpackhi_pd(a.v, b.v)};
+    }
+    friend SimdD operator-(SimdD a, SimdD b)
+    {
+        return {_mm256_sub_pd(a.v, b.v)};
+    }
+    friend SimdD max(SimdD a, SimdD b)
+    {
+        return {_mm256_max_pd(a.v, b.v)};
+    }
+    friend SimdD fma(SimdD a, SimdD b, SimdD c)
+    {
+        return {_mm256_fmadd_pd(a.v, b.v, c.v)};
+    }
+    double sum() const
+    {
+        const __m128d low = _mm256_castpd256_pd128(v);
+        const __m128d high = _mm256_extractf128_pd(v, 1);
+        const __m128d pair = _mm_add_pd(low, high);
+        return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    }
+};
+#else
+struct SimdD
+{
+    static constexpr size_t width = 1;
+    double v;
+    static SimdD load(const double *p)
+    {
+        return {*p};
+    }
+    static SimdD set1(double x)
+    {
+        return {x};
+    }
+    void store(double *p) const
+    {
+        *p = v;
+    }
+    static SimdD unpackLo(SimdD a, SimdD)
+    {
+        return a;
+    }
+    static SimdD unpackHi(SimdD, SimdD b)
+    {
+        return b;
+    }
+    friend SimdD operator-(SimdD a, SimdD b)
+    {
+        return {a.v - b.v};
+    }
+    friend SimdD max(SimdD a, SimdD b)
+    {
+        return {std::max(a.v, b.v)};
+    }
+    friend SimdD fma(SimdD a, SimdD b, SimdD c)
+    {
+        return {a.v * b.v + c.v};
+    }
+    double sum() const
+    {
+        return v;
+    }
+};
+#endif
+} // namespace
+} // namespace PDFxTMD
@@ -0,0 +1,197 @@
+#include "PDFxTMDLib/Common/ThreadPool.h"
+#include "PDFxTMDLib/Common/Exception.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace PDFxTMD
+{
+namespace
+{
+thread_local bool t_inParallelRegion = false;
+
+// Serializes creation and resizing of the global pool; reads go through atomic_load.
+std::mutex g_globalPoolMtx;
+std::shared_ptr<ThreadPool> g_globalPool;
+std::atomic<size_t> g_globalThreads{0};
+
+/// Marks the current thread as running inside a parallel region for the scope lifetime.
+struct ParallelRegionGuard
+{
+    ParallelRegionGuard() : m_previous(t_inParallelRegion)
+    {
+        t_inParallelRegion = true;
+    }
+    ~ParallelRegionGuard()
+    {
+        t_inParallelRegion = m_previous;
+    }
+    bool m_previous;
+};
+
+/// State shared between the caller and the helper tasks of a single ParallelFor call.
+struct ParallelForState
+{
+    ParallelForState(size_t n_, size_t chunk_, const ThreadPool::RangeFunction &fn_)
+        : n(n_), chunk(chunk_), nChunks((n_ + chunk_ - 1) / chunk_), fn(fn_)
+    {
+    }
+
+    /// Grabs chunks until none are left. Returns after the last grabbed chunk has finished.
+    void Drain()
+    {
+        ParallelRegionGuard guard;
+        for (size_t c = next.fetch_add(1); c < nChunks; c = next.fetch_add(1))
+        {
+            if (!failed.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    const size_t begin = c * chunk;
+                    fn(begin, std::min(n, begin + chunk));
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    if (!error)
+                        error = std::current_exception();
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            if (done.fetch_add(1) + 1 == nChunks)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                cv.notify_all();
+            }
+        }
+    }
+
+    const size_t n;
+    const size_t chunk;
+    const size_t nChunks;
+    const ThreadPool::RangeFunction &fn;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex mtx;
+    std::condition_variable cv;
+};
+} // namespace
+
+ThreadPool::ThreadPool(size_t nThreads)
+{
+    m_workers.reserve(nThreads);
+    for (size_t i = 0; i < nThreads; ++i)
+        m_workers.emplace_back([this] { WorkerLoop(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto &worker : m_workers)
+        worker.join();
+}
+
+void ThreadPool::WorkerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+            if (m_stop && m_tasks.empty())
+                return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::ParallelFor(size_t n, size_t grain, const RangeFunction &fn, size_t maxThreads)
+{
+    if (n == 0)
+        return;
+    grain = std::max<size_t>(grain, 1);
+    size_t nThreads = m_workers.size() + 1;
+    if (maxThreads > 0)
+        nThreads = std::min(nThreads, maxThreads);
+
+    if (nThreads <= 1 || n <= grain || t_inParallelRegion)
+    {
+        ParallelRegionGuard guard;
+        fn(0, n);
+        return;
+    }
+
+    // A few chunks per thread smooths out members with uneven cost.
+    const size_t chunk = std::max(grain, (n + 4 * nThreads - 1) / (4 * nThreads));
+    auto state = std::make_shared<ParallelForState>(n, chunk, fn);
+    const size_t nHelpers = std::min(nThreads - 1, state->nChunks - 1);
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        for (size_t i = 0; i < nHelpers; ++i)
+            m_tasks.emplace_back([state] { state->Drain(); });
+    }
+    if (nHelpers == 1)
+        m_cv.notify_one();
+    else
+        m_cv.notify_all();
+
+    state->Drain();
+    {
+        std::unique_lock<std::mutex> lock(state->mtx);
+        state->cv.wait(lock, [&state] { return state->done.load() == state->nChunks; });
+    }
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
+
+bool ThreadPool::InParallelRegion()
+{
+    return t_inParallelRegion;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::Global()
+{
+    std::shared_ptr<ThreadPool> pool = std::atomic_load(&g_globalPool);
+    if (pool)
+        return pool;
+    std::lock_guard<std::mutex> lock(g_globalPoolMtx);
+    pool = std::atomic_load(&g_globalPool);
+    if (!pool)
+    {
+        pool = std::make_shared<ThreadPool>(0);
+        std::atomic_store(&g_globalPool, pool);
+    }
+    return pool;
+}
+
+size_t ThreadPool::GlobalThreads()
+{
+    return g_globalThreads.load(std::memory_order_acquire);
+}
+
+void ThreadPool::SetGlobalThreads(size_t nThreads)
+{
+    // A worker replacing its own pool would join itself when the previous pool is released.
+    if (t_inParallelRegion)
+        throw InvalidInputError("PDFxTMD::ThreadPool::SetGlobalThreads: the global pool cannot "
+                                "be resized from inside a parallel region.");
+    std::shared_ptr<ThreadPool> previous;
+    {
+        std::lock_guard<std::mutex> lock(g_globalPoolMtx);
+        previous = std::atomic_load(&g_globalPool);
+        if (previous && previous->size() == nThreads)
+            return;
+        std::atomic_store(&g_globalPool, std::make_shared<ThreadPool>(nThreads));
+        g_globalThreads.store(nThreads, std::memory_order_release);
+    }
+}
+} // namespace PDFxTMD
@@ -0,0 +1,66 @@
+#include <PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h>
+#include <map>
+#include <mutex>
+
+namespace PDFxTMD
+{
+namespace
+{
+std::mutex g_metadataCacheMtx;
+std::map<std::string, std::shared_ptr<const SetMetadata>> g_metadataCache;
+
+std::shared_ptr<const SetMetadata> BuildSetMetadata(const std::string &pdfSetName,
+                                                    const std::string &infoPath,
+                                                    std::shared_ptr<const ConfigWrapper> config)
+{
+    auto metadata = std::make_shared<SetMetadata>();
+    metadata->pdfSetName = pdfSetName;
+    metadata->infoPath = infoPath;
+    metadata->standardInfo = YamlStandardPDFInfoReader(*config);
+    metadata->errorInfo = YamlErrorInfoReader(*config);
+    metadata->implementationInfo = YamlImpelemntationInfoReader(*config);
+    try
+    {
+        metadata->couplingInfo = YamlCouplingInfoReader(*config);
+    }
+    catch (...)
+    {
+        metadata->couplingInfo = {std::nullopt, ErrorType::CONFIG_ConversionFailed};
+        metadata->couplingException = std::current_exception();
+    }
+    metadata->config = std::move(config);
+    return metadata;
+}
+} // namespace
+
+std::pair<std::shared_ptr<const SetMetadata>, ErrorType> SetMetadataReader(
+    const std::string &pdfSetName)
+{
+    auto infoPathPair = StandardInfoFilePath(pdfSetName);
+    if (infoPathPair.second != ErrorType::None)
+    {
+        return {nullptr, ErrorType::FILE_NOT_FOUND};
+    }
+    const std::string &infoPath = *infoPathPair.first;
+    // The parsed file is shared through ConfigWrapper::loadCached, which also notices changes
+    // on disk; the metadata is rebuilt whenever it hands out another parse.
+    auto config = ConfigWrapper::loadCached(infoPath);
+    if (!config)
+    {
+        return {nullptr, ErrorType::FILE_NOT_FOUND};
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_metadataCacheMtx);
+        auto it = g_metadataCache.find(infoPath);
+        if (it != g_metadataCache.end() && it->second->config == config &&
+            it->second->pdfSetName == pdfSetName)
+        {
+            return {it->second, ErrorType::None};
+        }
+    }
+    auto metadata = BuildSetMetadata(pdfSetName, infoPath, std::move(config));
+    std::lock_guard<std::mutex> lock(g_metadataCacheMtx);
+    g_metadataCache[infoPath] = metadata;
+    return {metadata, ErrorType::None};
+}
+} // namespace PDFxTMD
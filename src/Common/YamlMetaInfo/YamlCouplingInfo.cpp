@@ -9,12 +9,18 @@ namespace PDFxTMD
 std::pair<std::optional<YamlCouplingInfo>, ErrorType> YamlCouplingInfoReader(
     const std::string &yamlInfoPath)
 {
-    ConfigWrapper ConfigWrapper;
-    YamlCouplingInfo output;
-    if (!ConfigWrapper.loadFromFile(yamlInfoPath, ConfigWrapper::Format::YAML))
+    auto cachedConfig = ConfigWrapper::loadCached(yamlInfoPath);
+    if (!cachedConfig)
     {
         return {std::nullopt, ErrorType::FILE_NOT_FOUND};
     }
+    return YamlCouplingInfoReader(*cachedConfig);
+}
+
+std::pair<std::optional<YamlCouplingInfo>, ErrorType> YamlCouplingInfoReader(
+    const ConfigWrapper &ConfigWrapper)
+{
+    YamlCouplingInfo output;
     auto [mu_vec, mu_vecError] = ConfigWrapper.get<std::vector<double>>("AlphaS_Qs");
     if (mu_vecError == ErrorType::None)
     {
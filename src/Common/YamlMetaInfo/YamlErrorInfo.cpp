@@ -10,12 +10,18 @@ namespace PDFxTMD
 std::pair<std::optional<YamlErrorInfo>, ErrorType> YamlErrorInfoReader(
     const std::string &yamlInfoPath)
 {
-    ConfigWrapper ConfigWrapper;
-    YamlErrorInfo output;
-    if (!ConfigWrapper.loadFromFile(yamlInfoPath, ConfigWrapper::Format::YAML))
+    auto cachedConfig = ConfigWrapper::loadCached(yamlInfoPath);
+    if (!cachedConfig)
     {
         return {std::nullopt, ErrorType::FILE_NOT_FOUND};
     }
+    return YamlErrorInfoReader(*cachedConfig);
+}
+
+std::pair<std::optional<YamlErrorInfo>, ErrorType> YamlErrorInfoReader(
+    const ConfigWrapper &ConfigWrapper)
+{
+    YamlErrorInfo output;
 
     auto [ErrorType, ErrorTypeError] = ConfigWrapper.get<std::string>("ErrorType");
     if (ErrorTypeError == ErrorType::None)
@@ -6,12 +6,18 @@ namespace PDFxTMD
 std::pair<std::optional<YamlImpelemntationInfo>, ErrorType> YamlImpelemntationInfoReader(
     const std::string &yamlInfoPath)
 {
-    ConfigWrapper ConfigWrapper;
-    YamlImpelemntationInfo output;
-    if (!ConfigWrapper.loadFromFile(yamlInfoPath, ConfigWrapper::Format::YAML))
+    auto cachedConfig = ConfigWrapper::loadCached(yamlInfoPath);
+    if (!cachedConfig)
     {
         return {std::nullopt, ErrorType::FILE_NOT_FOUND};
     }
+    return YamlImpelemntationInfoReader(*cachedConfig);
+}
+
+std::pair<std::optional<YamlImpelemntationInfo>, ErrorType> YamlImpelemntationInfoReader(
+    const ConfigWrapper &ConfigWrapper)
+{
+    YamlImpelemntationInfo output;
     auto [reader, errorReader] = ConfigWrapper.get<std::string>("Reader");
     if (errorReader == ErrorType::None)
     {
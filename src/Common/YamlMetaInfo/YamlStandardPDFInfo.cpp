@@ -7,13 +7,19 @@ namespace PDFxTMD
 std::pair<std::optional<YamlStandardTMDInfo>, ErrorType> YamlStandardPDFInfoReader(
     const std::string &yamlInfoPath)
 {
-    ErrorType errTot = ErrorType::None;
-    ConfigWrapper ConfigWrapper;
-    YamlStandardTMDInfo output;
-    if (!ConfigWrapper.loadFromFile(yamlInfoPath, ConfigWrapper::Format::YAML))
+    auto cachedConfig = ConfigWrapper::loadCached(yamlInfoPath);
+    if (!cachedConfig)
     {
         return {std::nullopt, ErrorType::FILE_NOT_FOUND};
     }
+    return YamlStandardPDFInfoReader(*cachedConfig);
+}
+
+std::pair<std::optional<YamlStandardTMDInfo>, ErrorType> YamlStandardPDFInfoReader(
+    const ConfigWrapper &ConfigWrapper)
+{
+    ErrorType errTot = ErrorType::None;
+    YamlStandardTMDInfo output;
     //////OrderQCD
     auto [orderQCD, errorOrderQCD] = ConfigWrapper.get<int>("OrderQCD");
     if (errorOrderQCD != ErrorType::None)
@@ -1,6 +1,50 @@
 // FactoryWrapper.cpp
 #include "PDFxTMDLib/FortranFactoryWrapper.h"
-#include "stdio.h"
+#include "PDFxTMDLib/PDFSet.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "CInterfaceGuard.h"
+
+namespace
+{
+using AllFlavors = std::array<double, DEFAULT_TOTAL_PDFS>;
+static_assert(sizeof(AllFlavors) == DEFAULT_TOTAL_PDFS * sizeof(double),
+              "Fortran arrays of all flavors are read as std::array");
+
+PDFUncertaintyC ToC(const PDFxTMD::PDFUncertainty &uncertainty)
+{
+    return {uncertainty.central,      uncertainty.errplus,      uncertainty.errminus,
+            uncertainty.errsymm,      uncertainty.scale,        uncertainty.errplus_pdf,
+            uncertainty.errminus_pdf, uncertainty.errsymm_pdf,  uncertainty.errplus_par,
+            uncertainty.errminus_par, uncertainty.errsymm_par};
+}
+
+void ToC(const std::vector<PDFxTMD::PDFUncertainty> &uncertainties, PDFUncertaintyC *result)
+{
+    for (size_t i = 0; i < uncertainties.size(); ++i)
+        result[i] = ToC(uncertainties[i]);
+}
+
+size_t Count(int n)
+{
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+using TMDSet = PDFxTMD::PDFSet<PDFxTMD::TMDPDFTag>;
+using CPDFSet = PDFxTMD::PDFSet<PDFxTMD::CollinearPDFTag>;
+
+/// Runs @p body as the C interface does and stores the resulting pdfxtmd_status in @p status,
+/// so that no exception unwinds through the Fortran caller
+template <typename Body> void Run(const char *function, int *status, Body &&body) noexcept
+{
+    const pdfxtmd_status result = PDFxTMD::Guard(function, body);
+    if (status)
+        *status = result;
+}
+} // namespace
 
 extern "C"
 {
@@ -21,12 +65,27 @@ extern "C"
         return new (PDFxTMD::IQCDCoupling)(couplingFactory->mkCoupling(pdfSetName));
     }
 
+    void delete_coupling(void *couplingObject)
+    {
+        delete static_cast<PDFxTMD::IQCDCoupling *>(couplingObject);
+    }
+
     double alphaQCDMu2_wrapper(void *couplingObject, double mu2)
     {
         auto *coupling = static_cast<PDFxTMD::IQCDCoupling *>(couplingObject);
         return (*coupling).AlphaQCDMu2(mu2);
     }
 
+    void alphaQCDMu2_batch_wrapper(void *couplingObject, const double *mu2, double *alphas, int n,
+                                   int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(couplingObject, Count(n), {mu2, alphas});
+            auto *coupling = static_cast<PDFxTMD::IQCDCoupling *>(couplingObject);
+            coupling->AlphaQCDMu2(mu2, alphas, Count(n));
+        });
+    }
+
     // GenericTMDFactory
     void *create_tmd_factory()
     {
@@ -43,11 +102,48 @@ extern "C"
         auto *tmdFactory = static_cast<PDFxTMD::GenericTMDFactory *>(factory);
         return new (PDFxTMD::ITMD)(tmdFactory->mkTMD(pdfSetName, setMember));
     }
+
+    void delete_tmd(void *tmd_obj)
+    {
+        delete static_cast<PDFxTMD::ITMD *>(tmd_obj);
+    }
+
     double tmd_wrapper(void *tmd_obj, int flavor, double x, double kt2, double mu2)
     {
         auto *tmd = static_cast<PDFxTMD::ITMD *>(tmd_obj);
         return (*tmd).tmd(static_cast<PDFxTMD::PartonFlavor>(flavor), x, kt2, mu2);
     }
+
+    void tmd_all_wrapper(void *tmd_obj, double x, double kt2, double mu2, double *output,
+                         int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(tmd_obj, 1, {output});
+            auto *tmd = static_cast<PDFxTMD::ITMD *>(tmd_obj);
+            tmd->tmd(x, kt2, mu2, *reinterpret_cast<AllFlavors *>(output));
+        });
+    }
+
+    void tmd_batch_wrapper(void *tmd_obj, int flavor, const double *x, const double *kt2,
+                           const double *mu2, double *output, int n, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(tmd_obj, Count(n), {x, kt2, mu2, output});
+            auto *tmd = static_cast<PDFxTMD::ITMD *>(tmd_obj);
+            tmd->tmd(static_cast<PDFxTMD::PartonFlavor>(flavor), x, kt2, mu2, output, Count(n));
+        });
+    }
+
+    void tmd_all_batch_wrapper(void *tmd_obj, const double *x, const double *kt2,
+                               const double *mu2, double *output, int n, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(tmd_obj, Count(n), {x, kt2, mu2, output});
+            auto *tmd = static_cast<PDFxTMD::ITMD *>(tmd_obj);
+            tmd->tmd(x, kt2, mu2, reinterpret_cast<AllFlavors *>(output), Count(n));
+        });
+    }
+
     // GenericCPDFFactory
     void *create_cpdf_factory()
     {
@@ -62,12 +158,197 @@ extern "C"
     void *mk_cpdf(void *factory, const char *pdfSetName, int setMember)
     {
         auto *cpdfFactory = static_cast<PDFxTMD::GenericCPDFFactory *>(factory);
-        printf("pdfSetName %s", pdfSetName);
         return new (PDFxTMD::ICPDF)(cpdfFactory->mkCPDF(pdfSetName, setMember));
     }
+
+    void delete_cpdf(void *cpdf_obj)
+    {
+        delete static_cast<PDFxTMD::ICPDF *>(cpdf_obj);
+    }
+
     double cpdf_wrapper(void *cpdf_obj, int flavor, double x, double mu2)
     {
         auto *cpdf = static_cast<PDFxTMD::ICPDF *>(cpdf_obj);
         return (*cpdf).pdf(static_cast<PDFxTMD::PartonFlavor>(flavor), x, mu2);
     }
-}
\ No newline at end of file
+
+    void cpdf_all_wrapper(void *cpdf_obj, double x, double mu2, double *output, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(cpdf_obj, 1, {output});
+            auto *cpdf = static_cast<PDFxTMD::ICPDF *>(cpdf_obj);
+            cpdf->pdf(x, mu2, *reinterpret_cast<AllFlavors *>(output));
+        });
+    }
+
+    void cpdf_batch_wrapper(void *cpdf_obj, int flavor, const double *x, const double *mu2,
+                            double *output, int n, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(cpdf_obj, Count(n), {x, mu2, output});
+            auto *cpdf = static_cast<PDFxTMD::ICPDF *>(cpdf_obj);
+            const auto parton = static_cast<PDFxTMD::PartonFlavor>(flavor);
+            for (size_t i = 0; i < Count(n); ++i)
+                output[i] = cpdf->pdf(parton, x[i], mu2[i]);
+        });
+    }
+
+    void cpdf_all_batch_wrapper(void *cpdf_obj, const double *x, const double *mu2,
+                                double *output, int n, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(cpdf_obj, Count(n), {x, mu2, output});
+            auto *cpdf = static_cast<PDFxTMD::ICPDF *>(cpdf_obj);
+            auto *points = reinterpret_cast<AllFlavors *>(output);
+            for (size_t i = 0; i < Count(n); ++i)
+                cpdf->pdf(x[i], mu2[i], points[i]);
+        });
+    }
+
+    void last_error_message(char *message, int length)
+    {
+        if (!message || length <= 0)
+            return;
+        const char *error = pdfxtmd_last_error();
+        const size_t count = std::min(std::strlen(error), Count(length));
+        std::memcpy(message, error, count);
+        std::memset(message + count, ' ', Count(length) - count);
+    }
+
+    // PDFSet<TMDPDFTag>
+    void *create_tmd_set(const char *pdfSetName, int *status)
+    {
+        void *set = nullptr;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(pdfSetName, 0);
+            set = new TMDSet(pdfSetName);
+        });
+        return set;
+    }
+
+    void delete_tmd_set(void *set)
+    {
+        delete static_cast<TMDSet *>(set);
+    }
+
+    int tmd_set_size(void *set, int *status)
+    {
+        int size = 0;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 0);
+            size = static_cast<int>(static_cast<TMDSet *>(set)->size());
+        });
+        return size;
+    }
+
+    void *tmd_set_member(void *set, int member, int *status)
+    {
+        void *tmd = nullptr;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 0);
+            tmd = (*static_cast<TMDSet *>(set))[member];
+        });
+        return tmd;
+    }
+
+    double tmd_set_alphasQ2(void *set, double mu2, int *status)
+    {
+        double alphas = 0.0;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 0);
+            alphas = static_cast<TMDSet *>(set)->alphasQ2(mu2);
+        });
+        return alphas;
+    }
+
+    void tmd_set_uncertainty(void *set, int flavor, double x, double kt2, double mu2, double cl,
+                             PDFUncertaintyC *result, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 1, {result});
+            *result = ToC(static_cast<TMDSet *>(set)->Uncertainty(
+                static_cast<PDFxTMD::PartonFlavor>(flavor), x, kt2, mu2, cl));
+        });
+    }
+
+    void tmd_set_uncertainty_batch(void *set, int flavor, const double *x, const double *kt2,
+                                   const double *mu2, int n, double cl, PDFUncertaintyC *result,
+                                   int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, Count(n), {x, kt2, mu2, result});
+            std::vector<PDFxTMD::PDFUncertainty> uncertainties;
+            static_cast<TMDSet *>(set)->Uncertainty(static_cast<PDFxTMD::PartonFlavor>(flavor),
+                                                    x, kt2, mu2, Count(n), cl, uncertainties);
+            ToC(uncertainties, result);
+        });
+    }
+
+    // PDFSet<CollinearPDFTag>
+    void *create_cpdf_set(const char *pdfSetName, int *status)
+    {
+        void *set = nullptr;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(pdfSetName, 0);
+            set = new CPDFSet(pdfSetName);
+        });
+        return set;
+    }
+
+    void delete_cpdf_set(void *set)
+    {
+        delete static_cast<CPDFSet *>(set);
+    }
+
+    int cpdf_set_size(void *set, int *status)
+    {
+        int size = 0;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 0);
+            size = static_cast<int>(static_cast<CPDFSet *>(set)->size());
+        });
+        return size;
+    }
+
+    void *cpdf_set_member(void *set, int member, int *status)
+    {
+        void *cpdf = nullptr;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 0);
+            cpdf = (*static_cast<CPDFSet *>(set))[member];
+        });
+        return cpdf;
+    }
+
+    double cpdf_set_alphasQ2(void *set, double mu2, int *status)
+    {
+        double alphas = 0.0;
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 0);
+            alphas = static_cast<CPDFSet *>(set)->alphasQ2(mu2);
+        });
+        return alphas;
+    }
+
+    void cpdf_set_uncertainty(void *set, int flavor, double x, double mu2, double cl,
+                              PDFUncertaintyC *result, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, 1, {result});
+            *result = ToC(static_cast<CPDFSet *>(set)->Uncertainty(
+                static_cast<PDFxTMD::PartonFlavor>(flavor), x, mu2, cl));
+        });
+    }
+
+    void cpdf_set_uncertainty_batch(void *set, int flavor, const double *x, const double *mu2,
+                                    int n, double cl, PDFUncertaintyC *result, int *status)
+    {
+        Run(__func__, status, [&] {
+            PDFxTMD::CheckArguments(set, Count(n), {x, mu2, result});
+            std::vector<PDFxTMD::PDFUncertainty> uncertainties;
+            static_cast<CPDFSet *>(set)->Uncertainty(static_cast<PDFxTMD::PartonFlavor>(flavor),
+                                                     x, mu2, Count(n), cl, uncertainties);
+            ToC(uncertainties, result);
+        });
+    }
+}
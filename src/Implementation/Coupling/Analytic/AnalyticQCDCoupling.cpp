@@ -1,9 +1,67 @@
 #include "PDFxTMDLib/Implementation/Coupling/Analytic/AnalyticQCDCoupling.h"
 #include "PDFxTMDLib/Common/Exception.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 namespace PDFxTMD
 {
+namespace
+{
+/// Points per block of the batch evaluation; the scratch arrays live on the stack.
+constexpr size_t BatchChunk = 64;
+
+// Calculate terms up to qcdorder = 4 of the analytic approximation, given
+// ln(Q2/lambdaQCD^2), its log, and the flavour-dependent factors. The scalar and the batch
+// path both evaluate it with a runtime order on the same operands: instantiating it per order
+// lets the compiler contract the products into FMAs differently, which changes the last bit.
+inline double analyticExpansion(int order, double lnx, double lnlnx, double A, double beta1,
+                                double beta02, double B, double a_21, double C,
+                                double beta12beta1, double beta0beta1beta2x3, double beta3)
+{
+    const double lnlnx2 = lnlnx * lnlnx;
+    const double lnlnx3 = lnlnx * lnlnx * lnlnx;
+    const double y = 1 / lnx;
+
+    const double a_0 = 1;
+    double tmp = a_0;
+    if (order > 1)
+    {
+        const double a_1 = beta1 * lnlnx / beta02;
+        tmp -= a_1 * y;
+    }
+    if (order > 2)
+    {
+        const double a_20 = lnlnx2 - lnlnx;
+        const double a_22 = 1;
+        tmp += B * y * y * (a_20 + a_21 - a_22);
+    }
+    if (order > 3)
+    {
+        const double a_30 = beta12beta1 * (lnlnx3 - (5 / 2.) * lnlnx2 - 2 * lnlnx + 0.5);
+        const double a_31 = beta0beta1beta2x3 * lnlnx;
+        const double a_32 = 0.5 * beta02 * beta3;
+        tmp -= C * y * y * y * (a_30 + a_31 - a_32);
+    }
+    return A * y * tmp;
+}
+
+/// Expansion over a block of points with the flavour-dependent factors in contiguous arrays.
+void analyticExpansionBlock(int order, size_t m, const double *lnx, const double *lnlnx,
+                            const double *A, const double *beta1, const double *beta02,
+                            const double *B, const double *a_21, const double *C,
+                            const double *beta12beta1, const double *beta0beta1beta2x3,
+                            const double *beta3, double *out)
+{
+    for (size_t p = 0; p < m; ++p)
+        out[p] = analyticExpansion(order, lnx[p], lnlnx[p], A[p], beta1[p], beta02[p], B[p],
+                                   a_21[p], C[p], beta12beta1[p], beta0beta1beta2x3[p],
+                                   beta3[p]);
+}
+} // namespace
+
 void AnalyticQCDCoupling::initialize(const YamlCouplingInfo &couplingInfo)
 {
     m_couplingInfo = couplingInfo;
@@ -19,6 +77,7 @@ void AnalyticQCDCoupling::initialize(const YamlCouplingInfo &couplingInfo)
     {
         setLambda(5, m_couplingInfo.alphasLambda5);
     }
+    setupConstants();
 }
 // Recalculate nfmax and nfmin after a new lambda has been set
 void AnalyticQCDCoupling::setFlavors()
@@ -47,6 +106,64 @@ void AnalyticQCDCoupling::setLambda(unsigned int i, double lambda)
     m_lambdas[i] = lambda;
     setFlavors();
 }
+
+// Precompute the flavour thresholds and, for every number of active flavours that has a usable
+// lambda, the lambda and beta-function dependent factors of the expansion.
+void AnalyticQCDCoupling::setupConstants()
+{
+    m_nfConstants = {};
+    m_nThresholds = 0;
+    if (m_lambdas.empty())
+        return;
+
+    const bool fixedScheme = m_couplingInfo.flavorScheme == AlphasFlavorScheme::fixed;
+    for (int nf = 0; nf <= MaxNumFlavors; ++nf)
+    {
+        NfConstants &k = m_nfConstants[nf];
+        k.hasLambda = fixedScheme ? m_lambdas.count(m_couplingInfo.AlphaS_NumFlavors) > 0
+                                  : m_lambdas.begin()->first <= nf;
+        if (!k.hasLambda)
+            continue;
+        const double lambdaQCD_ = lambdaQCD(nf);
+        k.lambda2 = lambdaQCD_ * lambdaQCD_;
+
+        const std::vector<double> beta = betas(nf);
+        k.beta1 = beta[1];
+        k.beta02 = SQR(beta[0]);
+        const double beta12 = SQR(beta[1]);
+        k.A = 1 / beta[0];
+        k.B = beta12 / (k.beta02 * k.beta02);
+        k.a_21 = beta[2] * beta[0] / beta12;
+        k.C = 1. / (k.beta02 * k.beta02 * k.beta02);
+        k.beta12beta1 = beta12 * beta[1];
+        k.beta0beta1beta2x3 = 3 * beta[0] * beta[1] * beta[2];
+        k.beta3 = beta[3];
+    }
+
+    // numFlavorsQ2 takes the largest nf in [nfmin, nfmax] whose threshold lies below q2; with
+    // the thresholds sorted that is a prefix maximum over the ones below q2.
+    const std::map<PartonFlavor, double> &thresholds = m_couplingInfo.quarkThreshhold.empty()
+                                                           ? m_couplingInfo.quarkMasses
+                                                           : m_couplingInfo.quarkThreshhold;
+    std::array<std::pair<double, int>, MaxNumFlavors + 1> sorted;
+    for (int it = m_nfmin; it <= m_nfmax; ++it)
+    {
+        auto element = thresholds.find(static_cast<PartonFlavor>(it));
+        if (element == thresholds.end())
+            continue;
+        sorted[m_nThresholds++] = {SQR(element->second), it};
+    }
+    std::stable_sort(sorted.begin(), sorted.begin() + m_nThresholds,
+                     [](const auto &a, const auto &b) { return a.first < b.first; });
+    int nf = m_nfmin;
+    for (int i = 0; i < m_nThresholds; ++i)
+    {
+        nf = std::max(nf, sorted[i].second);
+        m_thresholds2[i] = sorted[i].first;
+        m_thresholdNf[i] = nf;
+    }
+}
+
 // Return the correct lambda for a given number of active flavours
 // Uses recursion to find the closest defined-but-lower lambda for the given
 // number of active flavours
@@ -74,6 +191,28 @@ double AnalyticQCDCoupling::lambdaQCD(int nf) const
         return lambda->second;
     }
 }
+
+// Same as numFlavorsQ2(q2, m_couplingInfo, m_nfmin, m_nfmax) on the precomputed thresholds
+int AnalyticQCDCoupling::numFlavors(double q2) const
+{
+    if (m_couplingInfo.flavorScheme == AlphasFlavorScheme::fixed)
+        return m_couplingInfo.AlphaS_NumFlavors;
+    int below = 0;
+    while (below < m_nThresholds && m_thresholds2[below] < q2)
+        ++below;
+    const int nf = below > 0 ? m_thresholdNf[below - 1] : m_nfmin;
+    return std::min(nf, m_couplingInfo.AlphaS_NumFlavors);
+}
+
+const AnalyticQCDCoupling::NfConstants &AnalyticQCDCoupling::constants(int nf) const
+{
+    if (nf >= 0 && nf <= MaxNumFlavors && m_nfConstants[nf].hasLambda)
+        return m_nfConstants[nf];
+    lambdaQCD(nf); // throws the error for the missing lambda
+    throw AlphaQCDError("Requested lambdaQCD for " + std::to_string(nf) +
+                        " number of flavours.");
+}
+
 // Calculate alpha_s(Q2) by an analytic approximation
 double AnalyticQCDCoupling::AlphaQCDMu2(double q2)
 {
@@ -83,57 +222,75 @@ double AnalyticQCDCoupling::AlphaQCDMu2(double q2)
     if (m_lambdas.empty())
         throw AlphaQCDError(
             "You need to set at least one lambda value to calculate alpha_s by analytic means!");
-    const int nf = numFlavorsQ2(q2, m_couplingInfo, m_nfmin, m_nfmax);
-    const double lambdaQCD_ = lambdaQCD(nf);
+    const NfConstants &k = constants(numFlavors(q2));
 
-    if (q2 <= lambdaQCD_ * lambdaQCD_)
+    if (q2 <= k.lambda2)
         return std::numeric_limits<double>::max();
 
-    // Get beta coeffs for the number of active (above threshold) quark flavours at energy Q
-    const std::vector<double> beta = betas(nf);
-    const double beta02 = SQR(beta[0]);
-    const double beta12 = SQR(beta[1]);
-
-    // Pre-calculate ln(Q2/lambdaQCD) and expansion term y = 1/ln(Q2/lambdaQCD)
-    const double x = q2 / (lambdaQCD_ * lambdaQCD_);
-    const double lnx = log(x);
-    const double lnlnx = log(lnx);
-    const double lnlnx2 = lnlnx * lnlnx;
-    const double lnlnx3 = lnlnx * lnlnx * lnlnx;
-    const double y = 1 / lnx;
-
-    // Calculate terms up to qcdorder = 4
-    // A bit messy because the actual expressions are
-    // quite messy...
     /// @todo Is it okay to use _alphas_mz as the constant value?
     if (m_couplingInfo.alphasOrder == OrderQCD::LO)
         return m_couplingInfo.AlphaS_MZ;
-    const double A = 1 / beta[0];
-    const double a_0 = 1;
-    double tmp = a_0;
-    if ((int)m_couplingInfo.alphasOrder > 1)
-    {
-        const double a_1 = beta[1] * lnlnx / beta02;
-        tmp -= a_1 * y;
-    }
-    if ((int)m_couplingInfo.alphasOrder > 2)
-    {
-        const double B = beta12 / (beta02 * beta02);
-        const double a_20 = lnlnx2 - lnlnx;
-        const double a_21 = beta[2] * beta[0] / beta12;
-        const double a_22 = 1;
-        tmp += B * y * y * (a_20 + a_21 - a_22);
-    }
-    if ((int)m_couplingInfo.alphasOrder > 3)
+
+    // Pre-calculate ln(Q2/lambdaQCD) and expansion term y = 1/ln(Q2/lambdaQCD)
+    const double lnx = log(q2 / k.lambda2);
+    return analyticExpansion(static_cast<int>(m_couplingInfo.alphasOrder), lnx, log(lnx), k.A,
+                             k.beta1, k.beta02, k.B, k.a_21, k.C, k.beta12beta1,
+                             k.beta0beta1beta2x3, k.beta3);
+}
+
+// Batch evaluation in blocks: the flavour-dependent factors of each point are gathered into
+// contiguous arrays first, so that the expansion itself is an elementwise loop the compiler can
+// vectorize. The logarithms stay libm calls, as in the scalar path.
+void AnalyticQCDCoupling::AlphaQCDMu2(const double *mu2, double *alphas, size_t n)
+{
+    if (m_lambdas.empty())
+        throw AlphaQCDError(
+            "You need to set at least one lambda value to calculate alpha_s by analytic means!");
+    const int order = static_cast<int>(m_couplingInfo.alphasOrder);
+
+    std::array<double, BatchChunk> lnx, lnlnx, A, beta1, beta02, B, a_21, C, beta12beta1,
+        beta0beta1beta2x3, beta3;
+    std::array<bool, BatchChunk> belowLambda;
+    for (size_t start = 0; start < n; start += BatchChunk)
     {
-        const double C = 1. / (beta02 * beta02 * beta02);
-        const double a_30 = (beta12 * beta[1]) * (lnlnx3 - (5 / 2.) * lnlnx2 - 2 * lnlnx + 0.5);
-        const double a_31 = 3 * beta[0] * beta[1] * beta[2] * lnlnx;
-        const double a_32 = 0.5 * beta02 * beta[3];
-        tmp -= C * y * y * y * (a_30 + a_31 - a_32);
+        const size_t m = std::min(BatchChunk, n - start);
+        const double *q2 = mu2 + start;
+        double *out = alphas + start;
+        for (size_t p = 0; p < m; ++p)
+        {
+            const NfConstants &k = constants(numFlavors(q2[p]));
+            belowLambda[p] = q2[p] <= k.lambda2;
+            lnx[p] = q2[p] / k.lambda2;
+            A[p] = k.A;
+            beta1[p] = k.beta1;
+            beta02[p] = k.beta02;
+            B[p] = k.B;
+            a_21[p] = k.a_21;
+            C[p] = k.C;
+            beta12beta1[p] = k.beta12beta1;
+            beta0beta1beta2x3[p] = k.beta0beta1beta2x3;
+            beta3[p] = k.beta3;
+        }
+        if (order == static_cast<int>(OrderQCD::LO))
+        {
+            for (size_t p = 0; p < m; ++p)
+                out[p] = belowLambda[p] ? std::numeric_limits<double>::max()
+                                        : m_couplingInfo.AlphaS_MZ;
+            continue;
+        }
+        for (size_t p = 0; p < m; ++p)
+        {
+            // Points below lambda get a harmless dummy argument; their result is replaced below
+            lnx[p] = belowLambda[p] ? 2.0 : log(lnx[p]);
+            lnlnx[p] = log(lnx[p]);
+        }
+        analyticExpansionBlock(order, m, lnx.data(), lnlnx.data(), A.data(), beta1.data(),
+                               beta02.data(), B.data(), a_21.data(), C.data(),
+                               beta12beta1.data(), beta0beta1beta2x3.data(), beta3.data(), out);
+        for (size_t p = 0; p < m; ++p)
+            if (belowLambda[p])
+                out[p] = std::numeric_limits<double>::max();
     }
-    const double alphaS = A * y * tmp;
-    return alphaS;
 }
 
-} // namespace PDFxTMD
\ No newline at end of file
+} // namespace PDFxTMD
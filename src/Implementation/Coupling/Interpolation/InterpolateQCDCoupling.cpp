@@ -1,8 +1,9 @@
 #include "PDFxTMDLib/Implementation/Coupling/Interpolation/InterpolateQCDCoupling.h"
-#include <PDFxTMDLib/external/mlinterp/mlinterp.hpp>
+#include "PDFxTMDLib/Common/PartonUtils.h"
 #include <algorithm>
+#include <cassert>
 #include <cmath>
-#include <exception>
+#include <limits>
 
 namespace PDFxTMD
 {
@@ -13,23 +14,24 @@ void InterpolateQCDCoupling::initialize(const YamlCouplingInfo &couplingInfo)
     for (double mu_ : m_couplingInfo.mu_vec)
     {
         m_mu2_vec.push_back(SQR(mu_));
-        m_logMu2_vec.push_back(std::log(SQR(mu_)));
     }
     setup_grids();
 }
 
-/// @note This is const so it can be called silently from a const method
 void InterpolateQCDCoupling::setup_grids()
 {
-    if (!_knotarrays.empty())
+    if (!m_coeffs.empty())
         throw AlphaQCDError("AlphaS interpolation subgrids being initialized a second time!");
 
     if (m_mu2_vec.size() != m_alsphasVec_vec.size())
         throw MetadataError("AlphaS value and Q interpolation arrays are differently sized");
 
+    if (m_mu2_vec.size() < 2)
+        throw MetadataError("AlphaS interpolation needs at least two Q knots");
+
     // Walk along the Q2 vector, making subgrids at each boundary
     double prevQ2 = m_mu2_vec.front();
-    std::vector<double> q2s, as;
+    std::vector<double> q2s, logq2s, as;
     size_t combined_lenq2s = 0; //< For consistency checking
     for (size_t i = 0; i <= m_mu2_vec.size(); ++i)
     { //< The iteration to len+1 is intentional
@@ -40,20 +42,18 @@ void InterpolateQCDCoupling::setup_grids()
         // Note special treatment for the first and last points in q2s.
         if (fabs(currQ2 - prevQ2) < std::numeric_limits<double>::epsilon())
         {
-            // Sync current subgrid as as AlphaSArray
             if (i != 0)
             {
-                _knotarrays[q2s.front()] = AlphaSArray(q2s, as);
+                addSubgrid(q2s, logq2s, as);
                 combined_lenq2s += q2s.size();
             }
-            // Reset temporary vectors
             q2s.clear();
-            q2s.reserve(m_mu2_vec.size() - i);
+            logq2s.clear();
             as.clear();
-            as.reserve(m_mu2_vec.size() - i);
         }
         // Append current value to temporary vectors
         q2s.push_back(currQ2);
+        logq2s.push_back(std::log(currQ2));
         as.push_back(currAS);
         prevQ2 = currQ2;
     }
@@ -61,79 +61,132 @@ void InterpolateQCDCoupling::setup_grids()
         throw AlphaQCDError("Sum of alpha_s subgrid sizes does not match input knot array (" +
                             std::to_string(combined_lenq2s) + " vs. " +
                             std::to_string(m_mu2_vec.size()) + ")");
+    if (m_coeffs.empty())
+        throw AlphaQCDError("AlphaS interpolation grid has no non-empty Q interval");
+
+    // Using base 10 for logs to get constant gradient extrapolation in
+    // a log 10 - log 10 plot. Remember to take situations where the first
+    // knot also is a flavor threshold into account
+    size_t next_point = 1;
+    while (next_point + 1 < m_mu2_vec.size() && m_mu2_vec[0] == m_mu2_vec[next_point])
+        next_point++;
+    const double dlogq2 = log10(m_mu2_vec[next_point] / m_mu2_vec[0]);
+    const double dlogas = log10(m_alsphasVec_vec[next_point] / m_alsphasVec_vec[0]);
+    m_lowQ2LogGrad = dlogas / dlogq2;
+
+    setup_index();
 }
 
-double InterpolateQCDCoupling::interpolateCubic(double T, double VL, double VDL, double VH,
-                                                double VDH) const
+void InterpolateQCDCoupling::addSubgrid(const std::vector<double> &q2s,
+                                        const std::vector<double> &logq2s,
+                                        const std::vector<double> &as)
 {
-    // Pre-calculate powers of T
-    const double t2 = T * T;
-    const double t3 = t2 * T;
+    const size_t nIntervals = q2s.size() - 1;
+    auto forward = [&](size_t i) { return (as[i + 1] - as[i]) / (logq2s[i + 1] - logq2s[i]); };
+    auto backward = [&](size_t i) { return (as[i] - as[i - 1]) / (logq2s[i] - logq2s[i - 1]); };
+    auto central = [&](size_t i) { return 0.5 * (forward(i) + backward(i)); };
 
-    // Calculate left point
-    const double p0 = (2 * t3 - 3 * t2 + 1) * VL;
-    const double m0 = (t3 - 2 * t2 + T) * VDL;
+    for (size_t i = 0; i < nIntervals; ++i)
+    {
+        // Derivatives w.r.t. log(Q2) at both ends, one-sided at the subgrid edges
+        double didlogq2, di1dlogq2;
+        if (nIntervals == 1)
+        {
+            didlogq2 = forward(i);
+            di1dlogq2 = forward(i);
+        }
+        else if (i == 0)
+        {
+            didlogq2 = forward(i);
+            di1dlogq2 = central(i + 1);
+        }
+        else if (i == nIntervals - 1)
+        {
+            didlogq2 = central(i);
+            di1dlogq2 = backward(i + 1);
+        }
+        else
+        {
+            didlogq2 = central(i);
+            di1dlogq2 = central(i + 1);
+        }
 
-    // Calculate right point
-    const double p1 = (-2 * t3 + 3 * t2) * VH;
-    const double m1 = (t3 - t2) * VDH;
+        const double dlogq2 = logq2s[i + 1] - logq2s[i];
+        const double VL = as[i];
+        const double VH = as[i + 1];
+        const double VDL = didlogq2 * dlogq2;
+        const double VDH = di1dlogq2 * dlogq2;
 
-    return abs(p0 + m0 + p1 + m1) < 2. ? p0 + m0 + p1 + m1 : std::numeric_limits<double>::max();
+        m_q2Lo.push_back(q2s[i]);
+        m_logQ2Lo.push_back(logq2s[i]);
+        m_dlogQ2.push_back(dlogq2);
+        m_coeffs.push_back({2 * VL - 2 * VH + VDL + VDH, 3 * VH - 3 * VL - 2 * VDL - VDH, VDL, VL});
+    }
 }
 
-// Interpolate alpha_s from tabulated points in Q2 via metadata
-double InterpolateQCDCoupling::AlphaQCDMu2(double q2)
+void InterpolateQCDCoupling::setup_index()
 {
-    assert(q2 >= 0);
+    // A few buckets per interval keeps the forward scan in intervalIndex to a step or two for
+    // knots that are roughly uniform in log(Q2), and it stays correct for any spacing.
+    const size_t nBuckets = 4 * m_coeffs.size();
+    m_logQ2Min = std::log(m_mu2_vec.front());
+    const double logQ2Max = std::log(m_mu2_vec.back());
+    const double width = (logQ2Max - m_logQ2Min) / static_cast<double>(nBuckets);
+    m_invBucketWidth = width > 0 ? 1.0 / width : 0.0;
 
-    // Using base 10 for logs to get constant gradient extrapolation in
-    // a log 10 - log 10 plot
-    if (q2 < m_mu2_vec.front())
+    m_bucketIndex.assign(nBuckets, 0);
+    unsigned interval = 0;
+    for (size_t b = 0; b < nBuckets; ++b)
     {
-        // Remember to take situations where the first knot also is a
-        // flavor threshold into account
-        double dlogq2, dlogas;
-        unsigned int next_point = 1;
-        while (m_mu2_vec[0] == m_mu2_vec[next_point])
-            next_point++;
-        dlogq2 = log10(m_mu2_vec[next_point] / m_mu2_vec[0]);
-        dlogas = log10(m_alsphasVec_vec[next_point] / m_alsphasVec_vec[0]);
-        const double loggrad = dlogas / dlogq2;
-        return m_alsphasVec_vec[0] * pow(q2 / m_alsphasVec_vec[0], loggrad);
+        const double edge = m_logQ2Min + static_cast<double>(b) * width;
+        while (interval + 1 < m_logQ2Lo.size() && m_logQ2Lo[interval + 1] <= edge)
+            ++interval;
+        m_bucketIndex[b] = interval;
     }
+}
+
+size_t InterpolateQCDCoupling::intervalIndex(double q2, double logq2) const
+{
+    const double bucket = std::max(0.0, (logq2 - m_logQ2Min) * m_invBucketWidth);
+    size_t i = m_bucketIndex[std::min(static_cast<size_t>(bucket), m_bucketIndex.size() - 1)];
+    // The last interval starting at or below q2: at a flavor threshold this picks the upper
+    // subgrid, and q2Max falls in the last interval.
+    while (i + 1 < m_q2Lo.size() && m_q2Lo[i + 1] <= q2)
+        ++i;
+    while (i > 0 && m_q2Lo[i] > q2)
+        --i;
+    return i;
+}
+
+double InterpolateQCDCoupling::evaluate(double q2, double logq2) const
+{
+    if (!(q2 >= m_mu2_vec.front()))
+        return m_alsphasVec_vec[0] * pow(q2 / m_mu2_vec[0], m_lowQ2LogGrad);
 
     if (q2 > m_mu2_vec.back())
         return m_alsphasVec_vec.back();
 
-    // Retrieve the appropriate subgrid
-    auto it = --(_knotarrays.upper_bound(q2));
-    const AlphaSArray &arr = it->second;
-
-    // Get the Q/alpha_s index on this array which is *below* this Q point
-    const size_t i = arr.iq2below(q2);
+    const size_t i = intervalIndex(q2, logq2);
+    const double t = (logq2 - m_logQ2Lo[i]) / m_dlogQ2[i];
+    const std::array<double, 4> &c = m_coeffs[i];
+    const double alphas = ((c[0] * t + c[1]) * t + c[2]) * t + c[3];
+    return std::abs(alphas) < 2. ? alphas : std::numeric_limits<double>::max();
+}
 
-    // Calculate derivatives
-    double didlogq2, di1dlogq2;
-    if (i == 0)
-    {
-        didlogq2 = arr.ddlogq_forward(i);
-        di1dlogq2 = arr.ddlogq_central(i + 1);
-    }
-    else if (i == arr.logq2s().size() - 2)
-    {
-        didlogq2 = arr.ddlogq_central(i);
-        di1dlogq2 = arr.ddlogq_backward(i + 1);
-    }
-    else
-    {
-        didlogq2 = arr.ddlogq_central(i);
-        di1dlogq2 = arr.ddlogq_central(i + 1);
-    }
+// Interpolate alpha_s from tabulated points in Q2 via metadata
+double InterpolateQCDCoupling::AlphaQCDMu2(double q2)
+{
+    assert(q2 >= 0);
+    return evaluate(q2, std::log(q2));
+}
 
-    // Calculate alpha_s
-    const double dlogq2 = arr.logq2s()[i + 1] - arr.logq2s()[i];
-    const double tlogq2 = (log(q2) - arr.logq2s()[i]) / dlogq2;
-    return interpolateCubic(tlogq2, arr.alphas()[i], didlogq2 * dlogq2, arr.alphas()[i + 1],
-                            di1dlogq2 * dlogq2);
+void InterpolateQCDCoupling::AlphaQCDMu2(const double *mu2, double *alphas, size_t n)
+{
+    // The logarithms go first in their own pass so they can be computed back to back, the
+    // lookup and the polynomial then only touch the small coefficient tables.
+    for (size_t k = 0; k < n; ++k)
+        alphas[k] = std::log(mu2[k]);
+    for (size_t k = 0; k < n; ++k)
+        alphas[k] = evaluate(mu2[k], alphas[k]);
 }
 } // namespace PDFxTMD
@@ -1,18 +1,361 @@
 // taken from lhapdf library
 #include "PDFxTMDLib/Implementation/Coupling/ODE/ODEQCDCoupling.h"
 #include "PDFxTMDLib/Common/Exception.h"
-#include "PDFxTMDLib/Common/MathUtils.h"
+#include "PDFxTMDLib/Common/Logger.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace PDFxTMD
 {
+namespace
+{
+/// Range of active flavours the running and the decoupling are solved over, as in LHAPDF
+constexpr int MinNumFlavors = 0;
+constexpr int MaxNumFlavors = 6;
+
+/// Solved grids kept by the process; the least recently used one is dropped beyond this
+constexpr size_t MaxSolvedGrids = 32;
+
+/// Integrates d alpha_s / d log(Q2) = -(beta0 alpha_s^2 + beta1 alpha_s^3 + ...) with the
+/// Dormand-Prince 5(4) pair. Steps never cross a flavour threshold, so the number of flavours is
+/// constant within each of them, and the last accepted step keeps the coefficients of its
+/// fourth-order interpolant to give alpha_s anywhere inside it.
+class RunningSolver
+{
+  public:
+    RunningSolver(const YamlCouplingInfo &couplingInfo, double q2, double alphas)
+        : m_couplingInfo(couplingInfo)
+    {
+        m_nTerms = std::min(static_cast<int>(couplingInfo.alphasOrder), 4);
+        for (int nf = MinNumFlavors; nf <= MaxNumFlavors; ++nf)
+        {
+            const std::vector<double> beta = betas(nf);
+            std::copy(beta.begin(), beta.begin() + 4, m_beta[nf].begin());
+        }
+        if (couplingInfo.flavorScheme == AlphasFlavorScheme::variable)
+        {
+            const std::map<PartonFlavor, double> &thresholds = couplingInfo.quarkThreshhold.empty()
+                                                                   ? couplingInfo.quarkMasses
+                                                                   : couplingInfo.quarkThreshhold;
+            for (int it = 0; it <= 6; ++it)
+            {
+                auto element = thresholds.find(static_cast<PartonFlavor>(it));
+                if (element != thresholds.end() && element->second > 0)
+                    m_logThresholds.push_back(std::log(SQR(element->second)));
+            }
+            std::sort(m_logThresholds.begin(), m_logThresholds.end());
+        }
+        restart(q2, alphas);
+    }
+
+    /// alpha_s at @p q2 from the interpolant of the step covering it, or max once it diverged.
+    double valueAt(double q2)
+    {
+        const double u = std::log(q2);
+        advance(u, false);
+        double y;
+        if (u == m_u)
+            y = m_y;
+        else if (m_haveStep && (u - m_u0) * (u - m_u) <= 0)
+            y = dense(u);
+        else
+            return std::numeric_limits<double>::max();
+        return (std::isfinite(y) && y <= 2.) ? y : std::numeric_limits<double>::max();
+    }
+
+    /// alpha_s at @p q2 with the last step ending exactly there, for the flavour thresholds.
+    double landAt(double q2)
+    {
+        const double u = std::log(q2);
+        advance(u, true);
+        if (u != m_u || !std::isfinite(m_y) || m_y > 2.)
+            return std::numeric_limits<double>::max();
+        return m_y;
+    }
+
+    void restart(double q2, double alphas)
+    {
+        m_u = std::log(q2);
+        m_y = alphas;
+        m_haveStep = false;
+        m_diverged = !std::isfinite(alphas) || alphas > 2.;
+    }
+
+  private:
+    static constexpr double RelativeTolerance = 1e-10;
+    static constexpr double AbsoluteTolerance = 1e-13;
+    static constexpr int MaxSteps = 100000;
+
+    double slope(const std::array<double, 4> &beta, double y) const
+    {
+        double d = 0;
+        for (int i = m_nTerms - 1; i >= 0; --i)
+            d = d * y + beta[i];
+        return -d * y * y;
+    }
+
+    double dense(double u) const
+    {
+        const double theta = (u - m_u0) / m_stepH;
+        const double theta1 = 1 - theta;
+        return m_y0 + theta * (m_ydiff + theta1 * (m_bspl + theta * (m_rc4 + theta1 * m_rc5)));
+    }
+
+    // Steps towards u until it is covered by the last step or, when landing, reached exactly
+    void advance(double u, bool land)
+    {
+        for (int n = 0; n < MaxSteps; ++n)
+        {
+            if (m_diverged || u == m_u)
+                return;
+            if (!land && m_haveStep && (u - m_u0) * (u - m_u) <= 0)
+                return;
+            const double dir = u > m_u ? 1. : -1.;
+
+            // Never cross a flavour threshold, and stop on the target when landing
+            double uEnd = m_u + dir * m_h;
+            bool clipped = false;
+            for (double threshold : m_logThresholds)
+            {
+                if (dir * (threshold - m_u) > 0 && dir * (uEnd - threshold) > 0)
+                {
+                    uEnd = threshold;
+                    clipped = true;
+                }
+            }
+            if (land && dir * (uEnd - u) > 0)
+            {
+                uEnd = u;
+                clipped = true;
+            }
+            const double h = uEnd - m_u;
+            if (std::abs(h) <= 1e-14 * (1 + std::abs(m_u)))
+            {
+                m_diverged = true;
+                return;
+            }
+            const double qMid2 = std::exp(m_u + h / 2);
+            const std::array<double, 4> &beta = m_beta[numFlavorsQ2(qMid2, m_couplingInfo, MinNumFlavors, MaxNumFlavors)];
+
+            const double y = m_y;
+            const double k1 = slope(beta, y);
+            const double k2 = slope(beta, y + h * (k1 / 5));
+            const double k3 = slope(beta, y + h * (3 * k1 / 40 + 9 * k2 / 40));
+            const double k4 = slope(beta, y + h * (44 * k1 / 45 - 56 * k2 / 15 + 32 * k3 / 9));
+            const double k5 =
+                slope(beta, y + h * (19372 * k1 / 6561 - 25360 * k2 / 2187 + 64448 * k3 / 6561 -
+                                     212 * k4 / 729));
+            const double k6 =
+                slope(beta, y + h * (9017 * k1 / 3168 - 355 * k2 / 33 + 46732 * k3 / 5247 +
+                                     49 * k4 / 176 - 5103 * k5 / 18656));
+            const double y1 = y + h * (35 * k1 / 384 + 500 * k3 / 1113 + 125 * k4 / 192 -
+                                       2187 * k5 / 6784 + 11 * k6 / 84);
+            const double k7 = slope(beta, y1);
+            const double err = h * (71 * k1 / 57600 - 71 * k3 / 16695 + 71 * k4 / 1920 -
+                                    17253 * k5 / 339200 + 22 * k6 / 525 - k7 / 40);
+
+            const double scale =
+                AbsoluteTolerance + RelativeTolerance * std::max(std::abs(y), std::abs(y1));
+            const double ratio = std::abs(err) / scale;
+            if (!(ratio <= 1))
+            {
+                // Rejected, or the solution overflowed: retry with a shorter step
+                const double shrink = std::isfinite(ratio) ? 0.9 * std::pow(ratio, -0.2) : 0.2;
+                m_h = std::abs(h) * std::max(0.2, shrink);
+                continue;
+            }
+            const double grow = ratio > 0 ? 0.9 * std::pow(ratio, -0.2) : 5.;
+            const double hNext = std::abs(h) * std::min(5., std::max(0.2, grow));
+            m_h = clipped ? std::max(m_h, hNext) : hNext;
+
+            m_u0 = m_u;
+            m_y0 = y;
+            m_stepH = h;
+            m_ydiff = y1 - y;
+            m_bspl = h * k1 - m_ydiff;
+            m_rc4 = m_ydiff - h * k7 - m_bspl;
+            m_rc5 = h * (-12715105075. / 11282082432. * k1 + 87487479700. / 32700410799. * k3 -
+                         10690763975. / 1880347072. * k4 + 701980252875. / 199316789632. * k5 -
+                         1453857185. / 822651844. * k6 + 69997945. / 29380423. * k7);
+            m_haveStep = true;
+            m_u = uEnd;
+            m_y = y1;
+            // alpha_s beyond 2 has no accuracy any way; everything further out diverges
+            if (!std::isfinite(y1) || y1 > 2.)
+                m_diverged = true;
+        }
+        m_diverged = true;
+    }
+
+    const YamlCouplingInfo &m_couplingInfo;
+    int m_nTerms = 0;
+    std::array<std::array<double, 4>, MaxNumFlavors + 1> m_beta{};
+    std::vector<double> m_logThresholds;
+
+    double m_u = 0;
+    double m_y = 0;
+    double m_h = 0.1;
+    bool m_diverged = false;
+
+    // Last accepted step, from m_u0 to m_u, and its interpolant
+    bool m_haveStep = false;
+    double m_u0 = 0;
+    double m_y0 = 0;
+    double m_stepH = 0;
+    double m_ydiff = 0;
+    double m_bspl = 0;
+    double m_rc4 = 0;
+    double m_rc5 = 0;
+};
+
+/// Solved grids of this process, by coupling parameters, with the tick of their last use
+struct SolvedGridCache
+{
+    struct Entry
+    {
+        std::shared_ptr<const std::vector<double>> alphas;
+        uint64_t lastUse = 0;
+    };
+
+    std::shared_ptr<const std::vector<double>> find(const std::string &key)
+    {
+        auto cached = grids.find(key);
+        if (cached == grids.end())
+            return nullptr;
+        cached->second.lastUse = ++tick;
+        return cached->second.alphas;
+    }
+
+    /// Keeps the grid already cached under @p key if another thread solved it first
+    std::shared_ptr<const std::vector<double>> insert(
+        const std::string &key, std::shared_ptr<const std::vector<double>> alphas)
+    {
+        Entry &entry = grids.emplace(key, Entry{std::move(alphas), 0}).first->second;
+        entry.lastUse = ++tick;
+        auto result = entry.alphas;
+        while (grids.size() > MaxSolvedGrids)
+        {
+            auto victim = std::min_element(grids.begin(), grids.end(),
+                                           [](const auto &a, const auto &b) {
+                                               return a.second.lastUse < b.second.lastUse;
+                                           });
+            grids.erase(victim);
+        }
+        return result;
+    }
+
+    std::mutex mutex;
+    std::map<std::string, Entry> grids;
+    uint64_t tick = 0;
+};
+
+SolvedGridCache &solvedGridCache()
+{
+    static SolvedGridCache cache;
+    return cache;
+}
+
+constexpr char DiskCacheMagic[] = "PDFxTMD alpha_s ODE grid v1\n";
+
+// FNV-1a, stable across processes and builds unlike std::hash
+std::uint64_t fnv1a(const void *data, size_t size, std::uint64_t hash = 1469598103934665603ull)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string diskCachePath(const std::string &directory, const std::string &key)
+{
+    char name[64];
+    std::snprintf(name, sizeof(name), "alphas_ode_%016llx.bin",
+                  static_cast<unsigned long long>(fnv1a(key.data(), key.size())));
+    return (std::filesystem::path(directory) / name).string();
+}
+
+std::shared_ptr<const std::vector<double>> readDiskCache(const std::string &path,
+                                                         const std::string &key, size_t nKnots)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return nullptr;
+    std::string magic(sizeof(DiskCacheMagic) - 1, '\0');
+    std::uint64_t keySize = 0, size = 0;
+    file.read(&magic[0], magic.size());
+    file.read(reinterpret_cast<char *>(&keySize), sizeof(keySize));
+    if (!file || magic != DiskCacheMagic || keySize != key.size())
+        return nullptr;
+    std::string storedKey(keySize, '\0');
+    file.read(&storedKey[0], keySize);
+    file.read(reinterpret_cast<char *>(&size), sizeof(size));
+    if (!file || storedKey != key || size != nKnots)
+        return nullptr;
+    auto alphas = std::make_shared<std::vector<double>>(nKnots);
+    file.read(reinterpret_cast<char *>(alphas->data()), nKnots * sizeof(double));
+    if (!file)
+        return nullptr;
+    return alphas;
+}
+
+// Written under a unique name and renamed, so concurrent processes never read a partial file
+void writeDiskCache(const std::string &path, const std::string &key,
+                    const std::vector<double> &alphas)
+{
+    const std::string tmpPath =
+        path + ".tmp" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_" +
+        std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        const std::uint64_t keySize = key.size(), size = alphas.size();
+        file.write(DiskCacheMagic, sizeof(DiskCacheMagic) - 1);
+        file.write(reinterpret_cast<const char *>(&keySize), sizeof(keySize));
+        file.write(key.data(), key.size());
+        file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        file.write(reinterpret_cast<const char *>(alphas.data()), alphas.size() * sizeof(double));
+        if (file)
+        {
+            file.close();
+            std::error_code ec;
+            std::filesystem::rename(tmpPath, path, ec);
+            if (!ec)
+                return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::remove(tmpPath, ec);
+    PDFxTMDLOG << "Could not write the alpha_s ODE cache file " << path << std::endl;
+}
+} // namespace
+
 double ODEQCDCoupling::AlphaQCDMu2(double mu2)
 {
     return m_couplingInterp.AlphaQCDMu2(mu2);
 }
 
+void ODEQCDCoupling::AlphaQCDMu2(const double *mu2, double *alphas, size_t n)
+{
+    m_couplingInterp.AlphaQCDMu2(mu2, alphas, n);
+}
+
 void ODEQCDCoupling::initialize(const YamlCouplingInfo &couplingInfo)
 {
     // obtain mu2_vec and alphasVec by solving differential equation to use interpolation.
@@ -23,35 +366,48 @@ void ODEQCDCoupling::initialize(const YamlCouplingInfo &couplingInfo)
     std::transform(m_couplingInfo.mu_vec.begin(), m_couplingInfo.mu_vec.end(), m_mu2_vec.begin(),
                    [](double mu) { return mu * mu; });
 }
-// Solve the differential equation in alphaS using an implementation of RK4
+
+// Solve for alpha_s on the knots, or take the solution from the process or disk cache
 void ODEQCDCoupling::_interpolate()
 {
-    // Initial step size
-    double h = 2.0;
-    /// This the the relative error allowed for the adaptive step size.
-    const double allowed_relative = 0.01;
-
-    /// Accuracy of Q2 (error in Q2 within this / 2)
-    double accuracy = 0.001;
-
-    // Run in Q2 using RK4 algorithm until we are within our defined accuracy
-    double t;
-    double y;
+    _setupKnots();
 
-    if (m_couplingInfo.AlphaS_MassReference != -1)
+    const std::string key = _cacheKey();
+    SolvedGridCache &cache = solvedGridCache();
+    std::shared_ptr<const std::vector<double>> alphas;
     {
-        t = SQR(m_couplingInfo.AlphaS_MassReference); // starting point
-        y = m_couplingInfo.AlphaS_Reference;          // starting value
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        alphas = cache.find(key);
     }
-    else
+    if (!alphas)
     {
-        t = SQR(m_couplingInfo.MZ);   // starting point
-        y = m_couplingInfo.AlphaS_MZ; // starting value
+        const char *cacheDir = std::getenv("PDFXTMD_ALPHAS_CACHE_DIR");
+        const std::string path =
+            (cacheDir && *cacheDir) ? diskCachePath(cacheDir, key) : std::string();
+        if (!path.empty())
+            alphas = readDiskCache(path, key, m_mu2_vec.size());
+        if (!alphas)
+        {
+            alphas = std::make_shared<const std::vector<double>>(_solve());
+            if (!path.empty())
+                writeDiskCache(path, key, *alphas);
+        }
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        alphas = cache.insert(key, std::move(alphas));
     }
 
-    // If a vector of knots in q2 has been given, solve for those.
-    // This creates a default grid which should be overkill for most
-    // purposes
+    m_couplingInfo.alphas_vec = *alphas;
+    m_couplingInfo.mu_vec.resize(m_mu2_vec.size());
+    std::transform(m_mu2_vec.begin(), m_mu2_vec.end(), m_couplingInfo.mu_vec.begin(),
+                   [](double mu2) { return std::sqrt(mu2); });
+    m_couplingInterp.initialize(m_couplingInfo);
+}
+
+// If a vector of knots in q2 has been given, solve for those.
+// Otherwise create a default grid which should be overkill for most
+// purposes
+void ODEQCDCoupling::_setupKnots()
+{
     if (m_mu2_vec.empty())
     {
         for (int q = 1; (q / 10.) < 1; ++q)
@@ -71,27 +427,16 @@ void ODEQCDCoupling::_interpolate()
             m_mu2_vec.push_back(SQR(50 * q));
         }
 
-        if (m_couplingInfo.quarkThreshhold.empty())
-        {
-            for (int it = 4; it <= 6; ++it)
-            {
-                auto element = m_couplingInfo.quarkMasses.find(static_cast<PartonFlavor>(it));
-                if (element == m_couplingInfo.quarkMasses.end())
-                    continue;
-                m_mu2_vec.push_back(SQR(element->second));
-                m_mu2_vec.push_back(SQR(element->second));
-            }
-        }
-        else
+        const std::map<PartonFlavor, double> &thresholds = m_couplingInfo.quarkThreshhold.empty()
+                                                               ? m_couplingInfo.quarkMasses
+                                                               : m_couplingInfo.quarkThreshhold;
+        for (int it = 4; it <= 6; ++it)
         {
-            for (int it = 4; it <= 6; ++it)
-            {
-                auto element = m_couplingInfo.quarkThreshhold.find(static_cast<PartonFlavor>(it));
-                if (element == m_couplingInfo.quarkThreshhold.end())
-                    continue;
-                m_mu2_vec.push_back(SQR(element->second));
-                m_mu2_vec.push_back(SQR(element->second));
-            }
+            auto element = thresholds.find(static_cast<PartonFlavor>(it));
+            if (element == thresholds.end())
+                continue;
+            m_mu2_vec.push_back(SQR(element->second));
+            m_mu2_vec.push_back(SQR(element->second));
         }
         std::sort(m_mu2_vec.begin(), m_mu2_vec.end());
     }
@@ -100,82 +445,43 @@ void ODEQCDCoupling::_interpolate()
     // use it)
     if (m_mu2_vec[m_mu2_vec.size() - 1] < SQR(m_couplingInfo.MZ))
         m_mu2_vec.push_back(SQR(m_couplingInfo.MZ));
+}
 
-    // Find the index of the knot right below m_{Z}
-    unsigned int index_of_mz_lower = 0;
-
-    while (m_mu2_vec[index_of_mz_lower + 1] < SQR(m_couplingInfo.MZ))
-    {
-        if (index_of_mz_lower == m_mu2_vec.size() - 1)
-            break;
-        index_of_mz_lower++;
-    }
-
-    std::vector<std::pair<int, double>> grid; // for storing in correct order
-    grid.reserve(m_mu2_vec.size());
-    double low_lim = 0;
-    double last_val = -1;
-    bool threshold = false;
-
-    // We do this by starting from m_{Z}, going down to the lowest q2,
-    // and then jumping back up to m_{Z} to avoid calculating things twice
-    for (int ind = index_of_mz_lower; ind >= 0; --ind)
-    {
-        const double q2 = m_mu2_vec[ind];
-        // Deal with cases with two identical adjacent points (thresholds) by decreasing step size,
-        // allowed errors, and accuracy.
-        if (ind != 0 && ind != 1)
-        {
-            if (q2 == m_mu2_vec[ind - 1])
-            {
-                last_val = q2;
-                threshold = true;
-                _solve(q2, t, y, allowed_relative / 5, h / 5, accuracy / 5);
-                grid.emplace_back(std::make_pair(ind, y));
-                y = y * _decouple(y, t, numFlavorsQ2(m_mu2_vec[ind + 1], m_couplingInfo),
-                                  numFlavorsQ2(m_mu2_vec[ind - 2], m_couplingInfo));
-                // Define divergence after y > 2. -- we have no accuracy after that any way
-                if (y > 2.)
-                {
-                    low_lim = q2;
-                }
-                continue;
-            }
-        }
-        // If q2 is lower than a value that already diverged, it will also diverge
-        if (q2 < low_lim)
-        {
-            grid.emplace_back(std::make_pair(ind, std::numeric_limits<double>::max()));
-            continue;
-            // If last point was the same we don't need to recalculate
-        }
-        else if (q2 == last_val)
-        {
-            grid.emplace_back(std::make_pair(ind, y));
-            continue;
-            // Else calculate
-        }
-        else
-        {
-            last_val = q2;
-            if (threshold)
-            {
-                _solve(q2, t, y, allowed_relative / 5, h / 5, accuracy / 5);
-                threshold = false;
-            }
-            else
-            {
-                _solve(q2, t, y, allowed_relative, h, accuracy);
-            }
-            grid.emplace_back(std::make_pair(ind, y));
-            // Define divergence after y > 2. -- we have no accuracy after that any way
-            if (y > 2.)
-            {
-                low_lim = q2;
-            }
-        }
-    }
+// Everything the solved grid depends on, with the doubles in hex so that the key is exact
+std::string ODEQCDCoupling::_cacheKey() const
+{
+    std::string key = "order=" + std::to_string(static_cast<int>(m_couplingInfo.alphasOrder)) +
+                      ";scheme=" + std::to_string(static_cast<int>(m_couplingInfo.flavorScheme)) +
+                      ";nf=" + std::to_string(m_couplingInfo.AlphaS_NumFlavors);
+    auto add = [&key](const std::string &name, double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%a", value);
+        key += ";" + name + "=" + buffer;
+    };
+    add("mz", m_couplingInfo.MZ);
+    add("asmz", m_couplingInfo.AlphaS_MZ);
+    add("mref", m_couplingInfo.AlphaS_MassReference);
+    add("asref", m_couplingInfo.AlphaS_Reference);
+    for (const auto &threshold : m_couplingInfo.quarkThreshhold)
+        add("threshold" + std::to_string(threshold.first), threshold.second);
+    for (const auto &mass : m_couplingInfo.quarkMasses)
+        add("mass" + std::to_string(mass.first), mass.second);
+    // The knots follow from the parameters above unless they were given, so a hash will do
+    char knots[48];
+    std::snprintf(knots, sizeof(knots), ";knots=%zu:%016llx", m_mu2_vec.size(),
+                  static_cast<unsigned long long>(
+                      fnv1a(m_mu2_vec.data(), m_mu2_vec.size() * sizeof(double))));
+    return key + knots;
+}
 
+// Run alpha_s from the reference scale down to the lowest knot and then, starting over, up to
+// the highest one. At a repeated knot (a flavour threshold) the first copy gets the value on the
+// side already solved and the second the decoupled one. Once alpha_s exceeds 2 every knot further
+// out in that direction is set to max: there is no accuracy left there any way.
+std::vector<double> ODEQCDCoupling::_solve() const
+{
+    double t;
+    double y;
     if (m_couplingInfo.AlphaS_MassReference != -1)
     {
         t = SQR(m_couplingInfo.AlphaS_MassReference); // starting point
@@ -187,74 +493,53 @@ void ODEQCDCoupling::_interpolate()
         y = m_couplingInfo.AlphaS_MZ; // starting value
     }
 
-    for (size_t ind = index_of_mz_lower + 1; ind < m_mu2_vec.size(); ++ind)
-    {
-        double q2 = m_mu2_vec[ind];
-        // Deal with cases with two identical adjacent points (thresholds) by decreasing step size,
-        // allowed errors, and accuracy.
-        if (ind != m_mu2_vec.size() - 1 && ind != m_mu2_vec.size() - 2)
+    // Find the index of the knot right below m_{Z}
+    const long nKnots = static_cast<long>(m_mu2_vec.size());
+    long index_of_mz_lower = 0;
+    while (index_of_mz_lower + 1 < nKnots &&
+           m_mu2_vec[index_of_mz_lower + 1] < SQR(m_couplingInfo.MZ))
+        index_of_mz_lower++;
+
+    std::vector<double> alphas(m_mu2_vec.size());
+    auto walk = [&](long ind, long end, long dir) {
+        RunningSolver solver(m_couplingInfo, t, y);
+        double value = y;
+        double last_val = -1;
+        for (; ind != end; ind += dir)
         {
-            if (q2 == m_mu2_vec[ind + 1])
+            const double q2 = m_mu2_vec[ind];
+            if (value > 2.)
             {
-                last_val = q2;
-                _solve(q2, t, y, allowed_relative / 5, h / 5, accuracy / 5);
-                grid.emplace_back(std::make_pair(ind, y));
-                y = y * _decouple(y, t, numFlavorsQ2(m_mu2_vec[ind - 1], m_couplingInfo),
-                                  numFlavorsQ2(m_mu2_vec[ind + 2], m_couplingInfo));
-                // Define divergence after y > 2. -- we have no accuracy after that any way
-                if (y > 2.)
-                {
-                    low_lim = q2;
-                }
+                alphas[ind] = std::numeric_limits<double>::max();
                 continue;
             }
-        }
-        // If q2 is lower than a value that already diverged, it will also diverge
-        if (q2 < low_lim)
-        {
-            grid.emplace_back(std::make_pair(ind, std::numeric_limits<double>::max()));
-            continue;
-            // If last point was the same we don't need to recalculate
-        }
-        else if (q2 == last_val)
-        {
-            grid.emplace_back(std::make_pair(ind, y));
-            continue;
-            // Else calculate
-        }
-        else
-        {
-            last_val = q2;
-            _solve(q2, t, y, allowed_relative, h, accuracy);
-            grid.emplace_back(std::make_pair(ind, y));
-            // Define divergence after y > 2. -- we have no accuracy after that any way
-            if (y > 2.)
+            const long ahead2 = ind + 2 * dir;
+            if (ahead2 >= 0 && ahead2 < nKnots && q2 == m_mu2_vec[ind + dir])
             {
-                low_lim = q2;
+                value = solver.landAt(q2);
+                alphas[ind] = value;
+                if (value > 2.)
+                    continue;
+                value *= _decouple(value, q2,
+                                   numFlavorsQ2(m_mu2_vec[ind - dir], m_couplingInfo,
+                                                MinNumFlavors, MaxNumFlavors),
+                                   numFlavorsQ2(m_mu2_vec[ahead2], m_couplingInfo, MinNumFlavors,
+                                                MaxNumFlavors));
+                solver.restart(q2, value);
             }
+            else
+            {
+                // If the last point was the same we don't need to recalculate
+                if (q2 != last_val)
+                    value = solver.valueAt(q2);
+                alphas[ind] = value;
+            }
+            last_val = q2;
         }
-    }
-
-    std::sort(grid.begin(), grid.end(),
-              [](const std::pair<int, double> &a, const std::pair<int, double> &b) {
-                  return a.first < b.first;
-              });
-    /// @todo auto lambda args need C++14: std::sort(grid.begin(), grid.end(), [](const auto& a,
-    /// const auto& b) { return a.first < b.first; });
-
-    std::vector<double> alphas;
-    alphas.reserve(m_mu2_vec.size());
-
-    for (size_t x = 0; x < grid.size(); ++x)
-    {
-        // cout << sqrt(_q2s.at(x)) << "       " << grid.at(x).second << endl;
-        alphas.emplace_back(grid[x].second);
-    }
-    m_couplingInfo.alphas_vec = std::move(alphas);
-    m_couplingInfo.mu_vec.resize(m_mu2_vec.size());
-    std::transform(m_mu2_vec.begin(), m_mu2_vec.end(), m_couplingInfo.mu_vec.begin(),
-                   [](double mu2) { return std::sqrt(mu2); });
-    m_couplingInterp.initialize(m_couplingInfo);
+    };
+    walk(index_of_mz_lower, -1, -1);
+    walk(index_of_mz_lower + 1, nKnots, 1);
+    return alphas;
 }
 
 // Calculate decoupling for transition from num. flavour = ni -> nf
@@ -312,101 +597,5 @@ double ODEQCDCoupling::_decouple(double y, double t, unsigned int ni, unsigned i
     decoupling += as4;
     return decoupling;
 }
-// Calculate first order derivative, dy/dt, as it appears in the differential equation
-double ODEQCDCoupling::_derivative(double t, double y, const std::vector<double> &beta) const
-{
-    if (m_couplingInfo.alphasOrder == OrderQCD::LO)
-        return 0;
-    const double b0 = beta[0];
-    double d = (b0 * y * y);
-    if (m_couplingInfo.alphasOrder == OrderQCD::NLO)
-        return -d / t;
-    const double b1 = beta[1];
-    d += (b1 * y * y * y);
-    if (m_couplingInfo.alphasOrder == OrderQCD::N2LO)
-        return -d / t;
-    const double b2 = beta[2];
-    d += (b2 * y * y * y * y);
-    if (m_couplingInfo.alphasOrder == OrderQCD::N3LO)
-        return -d / t;
-    const double b3 = beta[3];
-    d += (b3 * y * y * y * y * y);
-    if (m_couplingInfo.alphasOrder == OrderQCD::N4LO)
-        return -d / t;
-    const double b4 = beta[4];
-    d += (b4 * y * y * y * y * y * y);
-    return -d / t;
-}
-
-// Calculate the next step, using recursion to achieve
-// adaptive step size. Passing by reference explained
-// below.
-void ODEQCDCoupling::_rk4(double &t, double &y, double h, const double allowed_change,
-                          const std::vector<double> &bs) const
-{
-
-    // Determine increments in y based on the slopes of the function at the
-    // beginning, midpoint, and end of the interval
-    const double k1 = h * _derivative(t, y, bs);
-    const double k2 = h * _derivative(t + h / 2.0, y + k1 / 2.0, bs);
-    const double k3 = h * _derivative(t + h / 2.0, y + k2 / 2.0, bs);
-    const double k4 = h * _derivative(t + h, y + k3, bs);
-    const double change = (k1 + 2 * k2 + 2 * k3 + k4) / 6.0;
-
-    // Only call recursively if Q2 > 1 GeV (constant step
-    // size after this)
-    if (t > 1. && fabs(change) > allowed_change)
-    {
-        _rk4(t, y, h / 2., allowed_change, bs);
-    }
-    else
-    {
-        y += change;
-        t += h;
-    }
-}
-
-// Solve for alpha_s(q2) using alpha_s = y and Q2 = t as starting points
-// Pass y and t by reference and change them to avoid having to
-// return them in a container -- bit confusing but should be more
-// efficient
-void ODEQCDCoupling::_solve(double q2, double &t, double &y, const double allowed_relative,
-                            double h, double accuracy) const
-{
-    if (q2 == t)
-        return;
-    while (fabs(q2 - t) > accuracy)
-    {
-        /// Can make the allowed change smaller as the q2 scale gets greater, does not seem
-        /// necessary
-        const double allowed_change = allowed_relative;
-
-        /// Mechanism to shrink the steps if accuracy < stepsize and we are close to Q2
-        if (fabs(h) > accuracy && fabs(q2 - t) / h < 10 && t > 1.)
-            h = accuracy / 2.1;
-        /// Take constant steps for Q2 < 1 GeV
-        if (fabs(h) > 0.01 && t < 1.)
-        {
-            accuracy = 0.0051;
-            h = 0.01;
-        }
-        // Check if we are going to run forward or backwards in energy scale towards target Q2.
-        /// @todo C++11's std::copysign would be perfect here
-        if ((q2 < t && sgn(h) > 0) || (q2 > t && sgn(h) < 0))
-            h *= -1;
-
-        // Get beta coefficients
-        const std::vector<double> bs = betas(numFlavorsQ2(t, m_couplingInfo));
-
-        // Calculate next step
-        _rk4(t, y, h, allowed_change, bs);
-
-        if (y > 2.)
-        {
-            y = std::numeric_limits<double>::max();
-            break;
-        }
-    }
-}
 
-} // namespace PDFxTMD
\ No newline at end of file
+} // namespace PDFxTMD
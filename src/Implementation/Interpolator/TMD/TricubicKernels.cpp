@@ -0,0 +1,94 @@
+#include <PDFxTMDLib/Common/Exception.h>
+#include <PDFxTMDLib/Implementation/Interpolator/TMD/TricubicKernels.h>
+#include <algorithm>
+
+namespace PDFxTMD
+{
+namespace
+{
+/// Derivative at knot @p i of values sampled at @p knots: the mean of the slopes to both
+/// neighbours, or the one-sided slope at the ends, as in LHAPDF. Repeated knots are skipped.
+double KnotDerivative(const std::vector<double> &knots, size_t i, double value, double below,
+                      double above)
+{
+    const bool hasBelow = i > 0 && knots[i] > knots[i - 1];
+    const bool hasAbove = i + 1 < knots.size() && knots[i + 1] > knots[i];
+    const double slopeBelow = hasBelow ? (value - below) / (knots[i] - knots[i - 1]) : 0.;
+    const double slopeAbove = hasAbove ? (above - value) / (knots[i + 1] - knots[i]) : 0.;
+    if (hasBelow && hasAbove)
+        return (slopeBelow + slopeAbove) * 0.5;
+    return hasBelow ? slopeBelow : slopeAbove;
+}
+} // namespace
+
+void TricubicGrid::initialize(const DefaultAllFlavorTMDShape &shape)
+{
+    m_knots = {&shape.log_x_vec, &shape.log_kt2_vec, &shape.log_mu2_vec};
+    const std::array<size_t, 3> counts = {shape.n_xs, shape.n_kt2s, shape.n_mu2s};
+    for (int axis = 0; axis < 3; axis++)
+    {
+        if (counts[axis] < 2)
+            throw InvalidFormatException(
+                "Tricubic interpolation needs at least two knots in x, kt2 and mu2");
+        m_axes[axis].initialize(*m_knots[axis]);
+    }
+    const size_t nFlavors = shape.n_flavors;
+    m_strides = {counts[1] * counts[2] * nFlavors * 8, counts[2] * nFlavors * 8, nFlavors * 8};
+
+    const size_t nValues = counts[0] * counts[1] * counts[2] * nFlavors;
+    m_table.assign(nValues * 8, 0.);
+    for (size_t ix = 0; ix < counts[0]; ++ix)
+        for (size_t ikt2 = 0; ikt2 < counts[1]; ++ikt2)
+            for (size_t iq2 = 0; iq2 < counts[2]; ++iq2)
+                for (size_t id = 0; id < nFlavors; ++id)
+                    m_table[ix * m_strides[0] + ikt2 * m_strides[1] + iq2 * m_strides[2] +
+                            id * 8] = shape.tmdxf(ix, ikt2, iq2, static_cast<int>(id));
+
+    // Each derivative slot differentiates, along its lowest axis, the slot without that axis,
+    // which is already filled: 1 = d/dx of 0, 2 = d/dkt2 of 0, 3 = d/dx of 2, and so on.
+    for (int slot = 1; slot < 8; slot++)
+    {
+        const int axis = slot & 1 ? 0 : (slot & 2 ? 1 : 2);
+        const int source = slot & ~(1 << axis);
+        const std::vector<double> &knots = *m_knots[axis];
+        const size_t stride = m_strides[axis];
+        for (size_t value = 0; value < nValues; ++value)
+        {
+            const size_t base = value * 8;
+            const size_t i = (base / stride) % counts[axis];
+            const double below = i > 0 ? m_table[base - stride + source] : 0.;
+            const double above = i + 1 < counts[axis] ? m_table[base + stride + source] : 0.;
+            m_table[base + slot] = KnotDerivative(knots, i, m_table[base + source], below, above);
+        }
+    }
+}
+
+void TricubicGrid::blend(const TricubicCell &cell, size_t firstColumn, size_t nColumns,
+                         double *output) const
+{
+    // Running sums per column and slot, filled corner by corner so that every corner is one
+    // contiguous read of nColumns * 8 values
+    constexpr size_t chunk = 16;
+    std::array<double, chunk * 8> sums;
+    for (size_t first = 0; first < nColumns; first += chunk)
+    {
+        const size_t count = std::min(chunk, nColumns - first);
+        const double *table = m_table.data() + (firstColumn + first) * 8;
+        std::fill(sums.begin(), sums.begin() + count * 8, 0.);
+        for (int corner = 0; corner < 8; corner++)
+        {
+            const double *values = table + cell.offsets[corner];
+            const double *weights = cell.weights.data() + corner * 8;
+            for (size_t column = 0; column < count; ++column)
+                for (int slot = 0; slot < 8; slot++)
+                    sums[column * 8 + slot] += weights[slot] * values[column * 8 + slot];
+        }
+        for (size_t column = 0; column < count; ++column)
+        {
+            const double *s = sums.data() + column * 8;
+            output[first + column] =
+                ((s[0] + s[4]) + (s[1] + s[5])) + ((s[2] + s[6]) + (s[3] + s[7]));
+        }
+    }
+}
+} // namespace PDFxTMD
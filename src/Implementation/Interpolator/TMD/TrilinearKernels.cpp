@@ -0,0 +1,64 @@
+#include <PDFxTMDLib/Implementation/Interpolator/TMD/TrilinearKernels.h>
+
+#include "../../../Common/SimdD.h"
+
+namespace PDFxTMD
+{
+void TrilinearAxis::initialize(const std::vector<double> &knots)
+{
+    m_knots = knots.data();
+    m_size = knots.size();
+    m_bucketIndex.assign(1, 0);
+    m_invBucketWidth = 0;
+    if (m_size < 2)
+        return;
+
+    // A few buckets per interval keeps the forward scan in locate to a step or two for knots
+    // that are roughly uniform in log, and it stays correct for any spacing.
+    const size_t nIntervals = m_size - 1;
+    const size_t nBuckets = 4 * nIntervals;
+    const double width = (knots.back() - knots.front()) / static_cast<double>(nBuckets);
+    m_invBucketWidth = width > 0 ? 1.0 / width : 0.0;
+
+    m_bucketIndex.assign(nBuckets, 0);
+    unsigned interval = 0;
+    for (size_t b = 0; b < nBuckets; ++b)
+    {
+        const double edge = knots.front() + static_cast<double>(b) * width;
+        while (interval + 1 < nIntervals && knots[interval + 1] <= edge)
+            ++interval;
+        m_bucketIndex[b] = interval;
+    }
+}
+
+void TrilinearGrid::initialize(const DefaultAllFlavorTMDShape &shape)
+{
+    m_axes[0].initialize(shape.log_x_vec);
+    m_axes[1].initialize(shape.log_kt2_vec);
+    m_axes[2].initialize(shape.log_mu2_vec);
+    m_strides = {shape.stride_ix, shape.stride_ikt2, shape.stride_iq2};
+    m_grid = shape.grids_flat.data();
+}
+
+void TrilinearGrid::blend(const TrilinearCell &cell, size_t firstColumn, size_t nColumns,
+                          double *output) const
+{
+    const double *grid = m_grid + firstColumn;
+    size_t column = 0;
+    for (; column + SimdD::width <= nColumns; column += SimdD::width)
+    {
+        SimdD acc = SimdD::set1(0.0);
+        for (int corner = 0; corner < cell.size; corner++)
+            acc = fma(SimdD::set1(cell.weights[corner]),
+                      SimdD::load(grid + cell.offsets[corner] + column), acc);
+        acc.store(output + column);
+    }
+    for (; column < nColumns; ++column)
+    {
+        double value = 0.;
+        for (int corner = 0; corner < cell.size; corner++)
+            value += cell.weights[corner] * grid[cell.offsets[corner] + column];
+        output[column] = value;
+    }
+}
+} // namespace PDFxTMD
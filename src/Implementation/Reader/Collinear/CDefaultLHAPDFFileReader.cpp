@@ -1,6 +1,8 @@
 #include "PDFxTMDLib/Implementation/Reader/Collinear/CDefaultLHAPDFFileReader.h"
 #include "PDFxTMDLib/Common/Exception.h"
+#include "PDFxTMDLib/Common/GridCache.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
+#include "PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h"
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h"
 #include <fstream>
 #include <string>
@@ -8,21 +10,17 @@
 namespace PDFxTMD
 {
 
-std::vector<double> CDefaultLHAPDFFileReader::getValues(PhaseSpaceComponent comp) const
+const std::vector<double> &CDefaultLHAPDFFileReader::getValues(PhaseSpaceComponent comp) const
 {
-    std::vector<double> output;
     switch (comp)
     {
     case PhaseSpaceComponent::X:
-        output = m_pdfShape_flat.x_vec;
-        break;
+        return m_pdfShape_flat->x_vec;
     case PhaseSpaceComponent::Q2:
-        output = m_pdfShape_flat.mu2_vec;
-        break;
+        return m_pdfShape_flat->mu2_vec;
     default:
         throw NotSupportError("undefined Phase space component requested");
     }
-    return output;
 }
 
 std::pair<double, double> CDefaultLHAPDFFileReader::getBoundaryValues(
@@ -49,26 +47,39 @@ void CDefaultLHAPDFFileReader::read(const std::string &pdfName, int setNumber)
         throw FileLoadException("PDF set " + pdfName + " not found!");
     }
 
-    auto infoPathPair = StandardInfoFilePath(pdfName);
-    if (infoPathPair.second != ErrorType::None)
+    const std::string &filePath = *filePathPair.first;
+    m_pdfShape_flat = GridCache::Global().GetOrLoad<DefaultAllFlavorShape>(
+        "CDefaultLHAPDFFileReader", filePath, [&]() { return parse(pdfName, filePath); });
+    m_xMinMax = {m_pdfShape_flat->x_vec.front(), m_pdfShape_flat->x_vec.back()};
+    m_q2MinMax = {m_pdfShape_flat->mu2_vec.front(), m_pdfShape_flat->mu2_vec.back()};
+}
+
+std::shared_ptr<DefaultAllFlavorShape> CDefaultLHAPDFFileReader::parse(const std::string &pdfName,
+                                                                        const std::string &filePath)
+{
+    auto [metadata, metadataError] = SetMetadataReader(pdfName);
+    if (metadataError != ErrorType::None)
     {
         throw FileLoadException("Unable to find info file of PDF set " + pdfName);
     }
 
-    auto pdfStandardInfo = YamlStandardPDFInfoReader(*infoPathPair.first);
+    const auto &pdfStandardInfo = metadata->standardInfo;
     if (pdfStandardInfo.second != ErrorType::None)
     {
-        throw InvalidFormatException("File " + *infoPathPair.first +
+        throw InvalidFormatException("File " + metadata->infoPath +
                                      " is not a standard info UPDF file");
     }
 
     YamlStandardPDFInfo standardPDFInfo = *pdfStandardInfo.first;
-    std::ifstream file(*filePathPair.first);
+    std::ifstream file(filePath);
     if (!file.is_open())
     {
-        throw PDFxTMD::FileLoadException("Unable to open file: " + *filePathPair.first);
+        throw PDFxTMD::FileLoadException("Unable to open file: " + filePath);
     }
 
+    m_blockNumber = 0;
+    m_blockLine = 0;
+    auto pdfShapeFlat = std::make_shared<DefaultAllFlavorShape>();
     std::string line;
     while (std::getline(file, line))
     {
@@ -113,14 +124,14 @@ void CDefaultLHAPDFFileReader::read(const std::string &pdfName, int setNumber)
     size_t n_x = m_pdfShape[0].x_vec.size();
     size_t n_mu2 = m_mu2CompTotal.size();
     size_t n_flavors = m_pdfShape.at(0)._pids.size();
-    m_pdfShape_flat.grids_flat.resize(n_mu2 * n_x * n_flavors, 0.0);
-    m_pdfShape_flat._pids = m_pdfShape.at(0)._pids;
-    m_pdfShape_flat.initPidLookup();
+    pdfShapeFlat->grids_flat.resize(n_mu2 * n_x * n_flavors, 0.0);
+    pdfShapeFlat->_pids = m_pdfShape.at(0)._pids;
+    pdfShapeFlat->initPidLookup();
     // Initialize the flat structure
-    m_pdfShape_flat.x_vec = m_pdfShape.at(0).x_vec;
-    m_pdfShape_flat.mu2_vec = m_mu2CompTotal;
-    m_pdfShape_flat.finalizeXP2();
-    m_pdfShape_flat.n_flavors = m_pdfShape_flat._pids.size();
+    pdfShapeFlat->x_vec = m_pdfShape.at(0).x_vec;
+    pdfShapeFlat->mu2_vec = m_mu2CompTotal;
+    pdfShapeFlat->finalizeXP2();
+    pdfShapeFlat->n_flavors = pdfShapeFlat->_pids.size();
     // Copy data from the structured format to the flat array
     for (size_t ix = 0; ix < n_x; ++ix)
     {
@@ -151,7 +162,7 @@ void CDefaultLHAPDFFileReader::read(const std::string &pdfName, int setNumber)
 
             // For each flavor, copy the value to the flat array
             size_t iflavor = 0;
-            for (auto flavor : m_pdfShape_flat._pids)
+            for (auto flavor : pdfShapeFlat->_pids)
             {
                 // Calculate flat index
                 size_t flat_index = ix * n_mu2 * n_flavors + iq2 * n_flavors + iflavor;
@@ -161,7 +172,7 @@ void CDefaultLHAPDFFileReader::read(const std::string &pdfName, int setNumber)
                               flavor) != pids_.end() &&
                     ix < m_pdfShape[shapeIndex].x_vec.size())
                 {
-                    m_pdfShape_flat.grids_flat[flat_index] = m_pdfShape[shapeIndex].getGridFromMap(
+                    pdfShapeFlat->grids_flat[flat_index] = m_pdfShape[shapeIndex].getGridFromMap(
                         static_cast<PartonFlavor>(flavor), ix, local_iq2);
                 }
 
@@ -169,23 +180,18 @@ void CDefaultLHAPDFFileReader::read(const std::string &pdfName, int setNumber)
             }
         }
     }
-    m_pdfShape_flat.grids.clear();
-    // After processing all data, set the boundary values once
-    const auto& x_vec_ = m_pdfShape[0].x_vec;
-    if (!m_pdfShape.empty() && !x_vec_.empty())
-    {
-        m_xMinMax = {x_vec_.front(), x_vec_.back()};
-    }
-
-    if (!m_mu2CompTotal.empty())
-    {
-        m_q2MinMax = {m_mu2CompTotal.front(), m_mu2CompTotal.back()};
-    }
+    pdfShapeFlat->grids.clear();
     m_mu2CompTotal.clear();
     m_pdfShape.clear();
+    return pdfShapeFlat;
+}
+
+const DefaultAllFlavorShape &CDefaultLHAPDFFileReader::getData() const
+{
+    return *m_pdfShape_flat;
 }
 
-DefaultAllFlavorShape CDefaultLHAPDFFileReader::getData() const
+std::shared_ptr<const DefaultAllFlavorShape> CDefaultLHAPDFFileReader::getSharedData() const
 {
     return m_pdfShape_flat;
 }
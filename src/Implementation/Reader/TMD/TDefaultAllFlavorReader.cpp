@@ -1,30 +1,53 @@
 #include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultAllFlavorReader.h"
 #include "PDFxTMDLib/Common/Exception.h"
+#include "PDFxTMDLib/Common/GridCache.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
+#include "PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h"
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h"
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <set>
+#include <vector>
 
 namespace PDFxTMD
 {
 
-DefaultAllFlavorTMDShape TDefaultAllFlavorReader::getData() const
+const DefaultAllFlavorTMDShape &TDefaultAllFlavorReader::getData() const
+{
+    return *m_updfShape;
+}
+std::shared_ptr<const DefaultAllFlavorTMDShape> TDefaultAllFlavorReader::getSharedData() const
 {
     return m_updfShape;
 }
+const std::vector<double> &TDefaultAllFlavorReader::getValues(PhaseSpaceComponent comp) const
+{
+    switch (comp)
+    {
+    case PhaseSpaceComponent::X:
+        return m_updfShape->x_vec;
+    case PhaseSpaceComponent::Kt2:
+        return m_updfShape->kt2_vec;
+    case PhaseSpaceComponent::Q2:
+        return m_updfShape->mu2_vec;
+    default:
+        throw NotSupportError("undefined Phase space component requested");
+    }
+}
 std::pair<double, double> TDefaultAllFlavorReader::getBoundaryValues(PhaseSpaceComponent comp) const
 {
     std::pair<double, double> output;
     switch (comp)
     {
     case PhaseSpaceComponent::X:
-        output = {m_updfShape.x_vec.front(), m_updfShape.x_vec.back()};
+        output = {m_updfShape->x_vec.front(), m_updfShape->x_vec.back()};
         break;
     case PhaseSpaceComponent::Kt2:
-        output = {m_updfShape.kt2_vec.front(), m_updfShape.kt2_vec.back()};
+        output = {m_updfShape->kt2_vec.front(), m_updfShape->kt2_vec.back()};
         break;
     case PhaseSpaceComponent::Q2:
-        output = {m_updfShape.mu2_vec.front(), m_updfShape.mu2_vec.back()};
+        output = {m_updfShape->mu2_vec.front(), m_updfShape->mu2_vec.back()};
         break;
     default:
         throw NotSupportError("undefined Phase space component requested");
@@ -39,16 +62,24 @@ void TDefaultAllFlavorReader::read(const std::string &pdfName, int setNumber)
         throw FileLoadException("PDF set " + pdfName + " not found!");
     }
 
-    auto infoPathPair = StandardInfoFilePath(pdfName);
-    if (infoPathPair.second != ErrorType::None)
+    const std::string &filePath = *filePathPair.first;
+    m_updfShape = GridCache::Global().GetOrLoad<DefaultAllFlavorTMDShape>(
+        "TDefaultAllFlavorReader", filePath, [&]() { return parse(pdfName, filePath); });
+}
+
+std::shared_ptr<DefaultAllFlavorTMDShape> TDefaultAllFlavorReader::parse(
+    const std::string &pdfName, const std::string &filePath)
+{
+    auto [metadata, metadataError] = SetMetadataReader(pdfName);
+    if (metadataError != ErrorType::None)
     {
         throw FileLoadException("Unable to find info file of PDF set " + pdfName);
     }
 
-    auto updfStandardInfo = YamlStandardPDFInfoReader(*infoPathPair.first);
+    const auto &updfStandardInfo = metadata->standardInfo;
     if (updfStandardInfo.second != ErrorType::None)
     {
-        throw InvalidFormatException("File " + *infoPathPair.first +
+        throw InvalidFormatException("File " + metadata->infoPath +
                                      " is not a standard info UPDF file");
     }
 
@@ -77,11 +108,12 @@ void TDefaultAllFlavorReader::read(const std::string &pdfName, int setNumber)
     {
         throw NotSupportError("Format " + standardUPDFInfo.Format + " is currently not supported!");
     }
-    std::ifstream file(*filePathPair.first);
+    std::ifstream file(filePath);
     if (!file.is_open())
     {
-        throw PDFxTMD::FileLoadException("Unable to open file: " + *filePathPair.first);
+        throw PDFxTMD::FileLoadException("Unable to open file: " + filePath);
     }
+    auto updfShape = std::make_shared<DefaultAllFlavorTMDShape>();
 
     // Read header lines
     std::string headerInfo[4];
@@ -90,88 +122,89 @@ void TDefaultAllFlavorReader::read(const std::string &pdfName, int setNumber)
         std::getline(file, line);
     }
 
-    std::set<double> log_xSet, log_q2Set, log_pSet;
-    double log_x = 0, log_q2 = 0, log_p = 0, tbar = 0, bbar = 0, cbar = 0, sbar = 0, ubar = 0,
-           dbar = 0, g = 0, d = 0, u = 0, s = 0, c = 0, b = 0, t = 0, photon = 0, z0 = 0, wplus = 0,
-           wminus = 0, higgs = 0;
-    m_updfShape.grids[PartonFlavor::tbar].reserve(1000);
-    m_updfShape.grids[PartonFlavor::bbar].reserve(1000);
-    m_updfShape.grids[PartonFlavor::cbar].reserve(1000);
-    m_updfShape.grids[PartonFlavor::sbar].reserve(1000);
-    m_updfShape.grids[PartonFlavor::dbar].reserve(1000);
-    m_updfShape.grids[PartonFlavor::ubar].reserve(1000);
-    m_updfShape.grids[PartonFlavor::g].reserve(1000);
-    m_updfShape.grids[PartonFlavor::t].reserve(1000);
-    m_updfShape.grids[PartonFlavor::b].reserve(1000);
-    m_updfShape.grids[PartonFlavor::c].reserve(1000);
-    m_updfShape.grids[PartonFlavor::s].reserve(1000);
-    m_updfShape.grids[PartonFlavor::d].reserve(1000);
-    m_updfShape.grids[PartonFlavor::u].reserve(1000);
+    // Columns after log(x), log(kt2) and log(mu)
+    updfShape->_pids = {-6, -5, -4, -3, -2, -1, 21, 1, 2, 3, 4, 5, 6, 22};
+    if (standardUPDFInfo.TMDScheme == "PB TMD-EW")
+    {
+        updfShape->_pids.insert(updfShape->_pids.end(),
+                                {PartonFlavor::z0, PartonFlavor::wplus, PartonFlavor::wminus,
+                                 PartonFlavor::higgs});
+    }
+    const size_t nFlavors = updfShape->_pids.size();
 
-    while (file >> log_x >> log_q2 >> log_p >> tbar >> bbar >> cbar >> sbar >> ubar >> dbar >> g >>
-           d >> u >> s >> c >> b >> t >> photon)
+    std::set<double> log_xSet, log_q2Set, log_pSet;
+    std::vector<std::array<double, 3>> knots;
+    std::vector<double> values;
+    knots.reserve(1000);
+    values.reserve(1000 * nFlavors);
+    std::array<double, 3> knot;
+    while (file >> knot[0] >> knot[1] >> knot[2])
     {
-        if (standardUPDFInfo.TMDScheme == "PB TMD-EW")
-        {
-            file >> z0 >> wplus >> wminus >> higgs;
-        }
-        else
-        {
-        }
-        if (log_x == 0 || log_q2 == 0 || log_p == 0)
+        if (knot[0] == 0 || knot[1] == 0 || knot[2] == 0)
         {
             throw InvalidFormatException("Invalid data file, log(x), log(q2), and log(p) "
                                          "cannot be 0");
         }
-
-        // Store unique log values
-        log_xSet.insert(log_x);
-        log_q2Set.insert(log_q2);
-        log_pSet.insert(log_p);
-
-        // Store data in shape
-        m_updfShape.grids[PartonFlavor::tbar].push_back(tbar);
-        m_updfShape.grids[PartonFlavor::bbar].push_back(bbar);
-        m_updfShape.grids[PartonFlavor::cbar].push_back(cbar);
-        m_updfShape.grids[PartonFlavor::sbar].push_back(sbar);
-        m_updfShape.grids[PartonFlavor::ubar].push_back(ubar);
-        m_updfShape.grids[PartonFlavor::dbar].push_back(dbar);
-        m_updfShape.grids[PartonFlavor::g].push_back(g);
-        m_updfShape.grids[PartonFlavor::gNS].push_back(g);
-        m_updfShape.grids[PartonFlavor::d].push_back(d);
-        m_updfShape.grids[PartonFlavor::u].push_back(u);
-        m_updfShape.grids[PartonFlavor::s].push_back(s);
-        m_updfShape.grids[PartonFlavor::c].push_back(c);
-        m_updfShape.grids[PartonFlavor::b].push_back(b);
-        m_updfShape.grids[PartonFlavor::t].push_back(t);
-        m_updfShape.grids[PartonFlavor::photon].push_back(photon);
-        if (standardUPDFInfo.TMDScheme == "PB TMD-EW")
+        for (size_t i = 0; i < nFlavors; i++)
         {
-            m_updfShape.grids[PartonFlavor::z0].push_back(z0);
-            m_updfShape.grids[PartonFlavor::wplus].push_back(wplus);
-            m_updfShape.grids[PartonFlavor::wminus].push_back(wminus);
-            m_updfShape.grids[PartonFlavor::higgs].push_back(higgs);
+            double value = 0;
+            if (!(file >> value))
+            {
+                throw InvalidFormatException("Invalid data file " + filePath +
+                                             ", incomplete line of flavors");
+            }
+            values.push_back(value);
         }
+
+        // Store unique log values
+        log_xSet.insert(knot[0]);
+        log_q2Set.insert(knot[1]);
+        log_pSet.insert(knot[2]);
+        knots.push_back(knot);
     }
 
-    m_updfShape.log_x_vec.assign(log_xSet.begin(), log_xSet.end());
-    m_updfShape.log_kt2_vec.assign(log_q2Set.begin(), log_q2Set.end());
+    updfShape->log_x_vec.assign(log_xSet.begin(), log_xSet.end());
+    updfShape->log_kt2_vec.assign(log_q2Set.begin(), log_q2Set.end());
     auto log_pSetSize = log_pSet.size();
-    m_updfShape.mu2_vec.reserve(log_pSetSize);
+    updfShape->mu2_vec.reserve(log_pSetSize);
     for (auto logP : log_pSet)
     {
         double mu = std::exp(logP);
-        m_updfShape.mu2_vec.push_back(mu * mu);
-        m_updfShape.log_mu2_vec.push_back(2 * logP);
+        updfShape->mu2_vec.push_back(mu * mu);
+        updfShape->log_mu2_vec.push_back(2 * logP);
     }
     for (auto log_kt2 : log_q2Set)
     {
-        m_updfShape.kt2_vec.emplace_back(std::exp(log_kt2));
+        updfShape->kt2_vec.emplace_back(std::exp(log_kt2));
     }
     for (auto log_x : log_xSet)
     {
-        m_updfShape.x_vec.emplace_back(std::exp(log_x));
+        updfShape->x_vec.emplace_back(std::exp(log_x));
+    }
+    updfShape->initTMDLayout();
+
+    if (knots.size() != log_xSet.size() * log_q2Set.size() * log_pSet.size())
+    {
+        throw InvalidFormatException("Invalid data file " + filePath +
+                                     ", the knots do not form a complete grid");
+    }
+    // Lines are placed by their knots, so the grid does not depend on the order of the file
+    const auto indexOf = [](const std::vector<double> &knotValues, double value) {
+        return static_cast<size_t>(
+            std::lower_bound(knotValues.begin(), knotValues.end(), value) - knotValues.begin());
+    };
+    std::vector<double> logPs(log_pSet.begin(), log_pSet.end());
+    updfShape->grids_flat.assign(knots.size() * nFlavors, 0.);
+    for (size_t line = 0; line < knots.size(); line++)
+    {
+        const size_t offset = indexOf(updfShape->log_x_vec, knots[line][0]) * updfShape->stride_ix +
+                              indexOf(updfShape->log_kt2_vec, knots[line][1]) *
+                                  updfShape->stride_ikt2 +
+                              indexOf(logPs, knots[line][2]) * updfShape->stride_iq2;
+        std::copy_n(values.begin() + line * nFlavors, nFlavors,
+                    updfShape->grids_flat.begin() + offset);
     }
+    return updfShape;
 }
 
 } // namespace PDFxTMD
\ No newline at end of file
@@ -1,30 +1,27 @@
 #include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultLHAPDF_TMDReader.h"
 #include "PDFxTMDLib/Common/Exception.h"
+#include "PDFxTMDLib/Common/GridCache.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
+#include "PDFxTMDLib/Common/YamlMetaInfo/SetMetadata.h"
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h"
 #include <fstream>
 #include <set>
 
 namespace PDFxTMD
 {
-std::vector<double> TDefaultLHAPDF_TMDReader::getValues(PhaseSpaceComponent comp) const
+const std::vector<double> &TDefaultLHAPDF_TMDReader::getValues(PhaseSpaceComponent comp) const
 {
-    std::vector<double> output;
     switch (comp)
     {
     case PhaseSpaceComponent::X:
-        output = m_pdfShape.x_vec;
-        break;
+        return m_pdfShape->x_vec;
     case PhaseSpaceComponent::Q2:
-        output = m_pdfShape.mu2_vec;
-        break;
+        return m_pdfShape->mu2_vec;
     case PhaseSpaceComponent::Kt2:
-        output = m_pdfShape.kt2_vec;
-        break;
+        return m_pdfShape->kt2_vec;
     default:
         throw NotSupportError("undefined Phase space component requested");
     }
-    return output;
 }
 
 std::pair<double, double> TDefaultLHAPDF_TMDReader::getBoundaryValues(
@@ -51,31 +48,44 @@ void TDefaultLHAPDF_TMDReader::read(const std::string &pdfName, int setNumber)
         throw FileLoadException("PDF set " + pdfName + " not found!");
     }
 
-    auto infoPathPair = StandardInfoFilePath(pdfName);
-    if (infoPathPair.second != ErrorType::None)
+    const std::string &filePath = *filePathPair.first;
+    m_pdfShape = GridCache::Global().GetOrLoad<DefaultAllFlavorTMDShape>(
+        "TDefaultLHAPDF_TMDReader", filePath, [&]() { return parse(pdfName, filePath); });
+    m_xMinMax = {m_pdfShape->x_vec.front(), m_pdfShape->x_vec.back()};
+    m_q2MinMax = {m_pdfShape->mu2_vec.front(), m_pdfShape->mu2_vec.back()};
+    m_kt2MinMax = {m_pdfShape->kt2_vec.front(), m_pdfShape->kt2_vec.back()};
+}
+
+std::shared_ptr<DefaultAllFlavorTMDShape> TDefaultLHAPDF_TMDReader::parse(
+    const std::string &pdfName, const std::string &filePath)
+{
+    auto [metadata, metadataError] = SetMetadataReader(pdfName);
+    if (metadataError != ErrorType::None)
     {
         throw FileLoadException("Unable to find info file of PDF set " + pdfName);
     }
 
-    auto pdfStandardInfo = YamlStandardPDFInfoReader(*infoPathPair.first);
+    const auto &pdfStandardInfo = metadata->standardInfo;
     if (pdfStandardInfo.second != ErrorType::None)
     {
-        throw InvalidFormatException("File " + *infoPathPair.first +
+        throw InvalidFormatException("File " + metadata->infoPath +
                                      " is not a standard info UPDF file");
     }
 
     YamlStandardPDFInfo standardPDFInfo = *pdfStandardInfo.first;
-    std::ifstream file(*filePathPair.first);
+    std::ifstream file(filePath);
     if (!file.is_open())
     {
-        throw PDFxTMD::FileLoadException("Unable to open file: " + *filePathPair.first);
+        throw PDFxTMD::FileLoadException("Unable to open file: " + filePath);
     }
 
+    m_blockNumber = 0;
+    m_blockLine = 0;
+    auto pdfShape = std::make_shared<DefaultAllFlavorTMDShape>();
     std::string line;
-    DefaultAllFlavorTMDShape data_;
-    m_pdfShape.x_vec.reserve(51);
-    m_pdfShape.mu2_vec.reserve(51);
-    m_pdfShape.kt2_vec.reserve(51);
+    pdfShape->x_vec.reserve(51);
+    pdfShape->mu2_vec.reserve(51);
+    pdfShape->kt2_vec.reserve(51);
     while (std::getline(file, line))
     {
         if (isComment(line) || line.empty())
@@ -98,26 +108,25 @@ void TDefaultLHAPDF_TMDReader::read(const std::string &pdfName, int setNumber)
         if (m_blockNumber == 0)
             continue;
 
-        processDataLine(line, m_pdfShape);
+        processDataLine(line, *pdfShape);
         m_blockLine++;
     }
 
-    for (auto partonFlavor : standardPartonFlavors)
+    if (pdfShape->grids_flat.size() != pdfShape->x_vec.size() * pdfShape->kt2_vec.size() *
+                                           pdfShape->mu2_vec.size() * pdfShape->_pids.size())
     {
-        if (m_pdfShape.grids[partonFlavor].size() == 0)
-        {
-            m_pdfShape.grids[partonFlavor].resize(
-                m_pdfShape.x_vec.size() * m_pdfShape.kt2_vec.size() * m_pdfShape.mu2_vec.size(),
-                0.);
-        }
+        throw InvalidFormatException("File " + filePath +
+                                     " does not hold a value for every knot and flavor");
     }
-    m_pdfShape.finalizeXKt2P2();
-    m_xMinMax = {m_pdfShape.x_vec.front(), m_pdfShape.x_vec.back()};
-    m_q2MinMax = {m_pdfShape.mu2_vec.front(), m_pdfShape.mu2_vec.back()};
-    m_kt2MinMax = {m_pdfShape.kt2_vec.front(), m_pdfShape.kt2_vec.back()};
+    pdfShape->finalizeXKt2P2();
+    return pdfShape;
 }
 
-DefaultAllFlavorTMDShape TDefaultLHAPDF_TMDReader::getData() const
+const DefaultAllFlavorTMDShape &TDefaultLHAPDF_TMDReader::getData() const
+{
+    return *m_pdfShape;
+}
+std::shared_ptr<const DefaultAllFlavorTMDShape> TDefaultLHAPDF_TMDReader::getSharedData() const
 {
     return m_pdfShape;
 }
@@ -184,25 +193,19 @@ void TDefaultLHAPDF_TMDReader::readParticleIds(NumParser &parser, DefaultAllFlav
     {
         throw std::runtime_error("No particle IDs found in grid");
     }
-    size_t gridSize = data.x_vec.size() * data.mu2_vec.size();
-    for (const auto &flavor : data._pids)
-    {
-        data.grids[static_cast<PartonFlavor>(flavor)].reserve(
-            data.grids[static_cast<PartonFlavor>(flavor)].size() + gridSize);
-    }
+    data.grids_flat.reserve(data.x_vec.size() * data.kt2_vec.size() * data.mu2_vec.size() *
+                            data._pids.size());
 }
 
 void TDefaultLHAPDF_TMDReader::readValues(NumParser &parser, DefaultAllFlavorTMDShape &data)
 {
+    // One line holds all flavors of a knot, matching the flavor-innermost layout of grids_flat
     double value;
     while (parser.hasMore())
     {
-        for (auto flavor : data._pids)
+        if (parser >> value)
         {
-            if (parser >> value)
-            {
-                data.grids[static_cast<PartonFlavor>(flavor)].push_back(value);
-            }
+            data.grids_flat.push_back(value);
         }
     }
 }
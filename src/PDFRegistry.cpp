@@ -0,0 +1,51 @@
+#include "PDFxTMDLib/PDFRegistry.h"
+#include "PDFxTMDLib/Implementation/Interpolator/Collinear/CLHAPDFBicubicInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/Collinear/CLHAPDFBilinearInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TTricubicInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TTrilinearInterpolator.h"
+#include "PDFxTMDLib/Implementation/Interpolator/TMD/TTrilinearTMDLibInterpolator.h"
+#include "PDFxTMDLib/Implementation/Reader/Collinear/CDefaultLHAPDFFileReader.h"
+#include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultAllFlavorReader.h"
+#include "PDFxTMDLib/Implementation/Reader/TMD/TDefaultLHAPDF_TMDReader.h"
+
+namespace PDFxTMD
+{
+namespace
+{
+void registerBuiltins(CPDFRegistry &registry)
+{
+    registry.registerInterpolator<CDefaultLHAPDFFileReader, CLHAPDFBicubicInterpolator>(
+        "CDefaultLHAPDFFileReader", "CLHAPDFBicubicInterpolator");
+    registry.registerInterpolator<CDefaultLHAPDFFileReader, CLHAPDFBilinearInterpolator>(
+        "CDefaultLHAPDFFileReader", "CLHAPDFBilinearInterpolator");
+}
+
+void registerBuiltins(TMDRegistry &registry)
+{
+    registry.registerInterpolator<TDefaultLHAPDF_TMDReader, TTrilinearInterpolator>(
+        "TDefaultLHAPDF_TMDReader", "TTrilinearInterpolator");
+    registry.registerInterpolator<TDefaultAllFlavorReader, TTrilinearTMDLibInterpolator>(
+        "TDefaultTMDLibAllflavorReader", "TTrilinearTMDLibInterpolator");
+    registry.registerInterpolator<TDefaultLHAPDF_TMDReader, TTricubicInterpolator>(
+        "TDefaultLHAPDF_TMDReader", "TTricubicInterpolator");
+    registry.registerInterpolator<TDefaultAllFlavorReader, TTricubicInterpolator>(
+        "TDefaultTMDLibAllflavorReader", "TTricubicInterpolator");
+}
+} // namespace
+
+template <> CPDFRegistry &CPDFRegistry::instance()
+{
+    static CPDFRegistry registry;
+    static const bool builtinsRegistered = (registerBuiltins(registry), true);
+    (void)builtinsRegistered;
+    return registry;
+}
+
+template <> TMDRegistry &TMDRegistry::instance()
+{
+    static TMDRegistry registry;
+    static const bool builtinsRegistered = (registerBuiltins(registry), true);
+    (void)builtinsRegistered;
+    return registry;
+}
+} // namespace PDFxTMD
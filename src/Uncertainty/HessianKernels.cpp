@@ -0,0 +1,115 @@
+#include <PDFxTMDLib/Common/PartonUtils.h>
+#include <PDFxTMDLib/Uncertainty/HessianKernels.h>
+#include <algorithm>
+
+#include "../Common/SimdD.h"
+
+namespace PDFxTMD
+{
+namespace
+{
+void HessianRow(const double *row, size_t nEigen, double &errplus2, double &errminus2,
+                double &errsymm2)
+{
+    const double central = row[0];
+    const SimdD c = SimdD::set1(central);
+    const SimdD zero = SimdD::set1(0.0);
+    SimdD accPlus = zero, accMinus = zero, accSymm = zero;
+    size_t i = 0;
+    for (; i + SimdD::width <= nEigen; i += SimdD::width)
+    {
+        const double *pair = row + 2 * i + 1;
+        const SimdD a = SimdD::load(pair);
+        const SimdD b = SimdD::load(pair + SimdD::width);
+        const SimdD up = SimdD::unpackLo(a, b);
+        const SimdD down = SimdD::unpackHi(a, b);
+        const SimdD ePlus = max(max(up - c, down - c), zero);
+        const SimdD eMinus = max(max(c - up, c - down), zero);
+        const SimdD diff = up - down;
+        accPlus = fma(ePlus, ePlus, accPlus);
+        accMinus = fma(eMinus, eMinus, accMinus);
+        accSymm = fma(diff, diff, accSymm);
+    }
+    double plus = accPlus.sum(), minus = accMinus.sum(), symm = accSymm.sum();
+    for (; i < nEigen; ++i)
+    {
+        const double up = row[2 * i + 1];
+        const double down = row[2 * i + 2];
+        plus += SQR(std::max(std::max(up - central, down - central), 0.0));
+        minus += SQR(std::max(std::max(central - up, central - down), 0.0));
+        symm += SQR(up - down);
+    }
+    errplus2 = plus;
+    errminus2 = minus;
+    errsymm2 = symm;
+}
+
+double SymmHessianRow(const double *row, size_t nEigen)
+{
+    const double central = row[0];
+    const SimdD c = SimdD::set1(central);
+    SimdD acc = SimdD::set1(0.0);
+    size_t i = 1;
+    for (; i + SimdD::width <= nEigen + 1; i += SimdD::width)
+    {
+        const SimdD d = SimdD::load(row + i) - c;
+        acc = fma(d, d, acc);
+    }
+    double sum = acc.sum();
+    for (; i <= nEigen; ++i)
+        sum += SQR(row[i] - central);
+    return sum;
+}
+} // namespace
+
+void HessianQuadratureSums(const double *values, size_t nPoints, size_t nMembers, size_t nEigen,
+                           double *errplus2, double *errminus2, double *errsymm2)
+{
+    for (size_t p = 0; p < nPoints; ++p)
+        HessianRow(values + p * nMembers, nEigen, errplus2[p], errminus2[p], errsymm2[p]);
+}
+
+void SymmHessianQuadratureSums(const double *values, size_t nPoints, size_t nMembers,
+                               size_t nEigen, double *errsymm2)
+{
+    for (size_t p = 0; p < nPoints; ++p)
+        errsymm2[p] = SymmHessianRow(values + p * nMembers, nEigen);
+}
+
+double HessianPairDifferenceDot(const double *valuesA, const double *valuesB, size_t nEigen)
+{
+    SimdD acc = SimdD::set1(0.0);
+    size_t i = 0;
+    for (; i + SimdD::width <= nEigen; i += SimdD::width)
+    {
+        const size_t offset = 2 * i + 1;
+        const SimdD a0 = SimdD::load(valuesA + offset);
+        const SimdD a1 = SimdD::load(valuesA + offset + SimdD::width);
+        const SimdD b0 = SimdD::load(valuesB + offset);
+        const SimdD b1 = SimdD::load(valuesB + offset + SimdD::width);
+        const SimdD diffA = SimdD::unpackLo(a0, a1) - SimdD::unpackHi(a0, a1);
+        const SimdD diffB = SimdD::unpackLo(b0, b1) - SimdD::unpackHi(b0, b1);
+        acc = fma(diffA, diffB, acc);
+    }
+    double dot = acc.sum();
+    for (; i < nEigen; ++i)
+        dot += (valuesA[2 * i + 1] - valuesA[2 * i + 2]) * (valuesB[2 * i + 1] - valuesB[2 * i + 2]);
+    return dot;
+}
+
+double SymmHessianDeviationDot(const double *valuesA, const double *valuesB, size_t nEigen)
+{
+    const SimdD centralA = SimdD::set1(valuesA[0]);
+    const SimdD centralB = SimdD::set1(valuesB[0]);
+    SimdD acc = SimdD::set1(0.0);
+    size_t i = 1;
+    for (; i + SimdD::width <= nEigen + 1; i += SimdD::width)
+    {
+        acc = fma(SimdD::load(valuesA + i) - centralA, SimdD::load(valuesB + i) - centralB, acc);
+    }
+    double dot = acc.sum();
+    for (; i <= nEigen; ++i)
+        dot += (valuesA[i] - valuesA[0]) * (valuesB[i] - valuesB[0]);
+    return dot;
+}
+} // namespace PDFxTMD
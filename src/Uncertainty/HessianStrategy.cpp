@@ -1,44 +1,100 @@
 #include <PDFxTMDLib/Common/PartonUtils.h>
+#include <PDFxTMDLib/Uncertainty/HessianKernels.h>
 #include <PDFxTMDLib/Uncertainty/HessianStrategy.h>
 #include <cmath>
+#include <vector>
 
 namespace PDFxTMD
 {
+namespace
+{
+// Calculate the asymmetric and symmetric Hessian uncertainties from the quadrature sums
+// using Eqs. (2.1), (2.2) and (2.6) of arXiv:1106.5788v2.
+void HessianUncertaintyFromSums(double central, double errplus2, double errminus2,
+                                double errsymm2, PDFUncertainty &uncertainty)
+{
+    uncertainty.errsymm = 0.5 * std::sqrt(errsymm2);
+    uncertainty.errplus = std::sqrt(errplus2);
+    uncertainty.errminus = std::sqrt(errminus2);
+    uncertainty.central = central;
+}
+
+void HessianUncertaintyRow(const double *values, const int numCoreErrMember,
+                           PDFUncertainty &uncertainty)
+{
+    double errplus2 = 0, errminus2 = 0, errsymm2 = 0;
+    HessianQuadratureSums(values, 1, numCoreErrMember + 1, numCoreErrMember / 2, &errplus2,
+                          &errminus2, &errsymm2);
+    HessianUncertaintyFromSums(values[0], errplus2, errminus2, errsymm2, uncertainty);
+}
+
+// Calculate the correlation over asymm Hessian vectors using Eq. (2.5) of arXiv:1106.5788
+double HessianCorrelationRow(const double *valuesA, const double *valuesB,
+                             const int numCoreErrMember, double errsymmA, double errsymmB)
+{
+    double cor = HessianPairDifferenceDot(valuesA, valuesB, numCoreErrMember / 2);
+    cor /= 4.0 * errsymmA * errsymmB;
+    return cor;
+}
+
+/// Uncertainties of every row of a points x members block, from one call of the block kernel
+void HessianUncertaintyBlock(const std::vector<double> &values, size_t nPoints, size_t nMembers,
+                             const int numCoreErrMember,
+                             std::vector<PDFUncertainty> &uncertainties)
+{
+    std::vector<double> sums(3 * nPoints);
+    double *errplus2 = sums.data(), *errminus2 = errplus2 + nPoints,
+           *errsymm2 = errminus2 + nPoints;
+    HessianQuadratureSums(values.data(), nPoints, nMembers, numCoreErrMember / 2, errplus2,
+                          errminus2, errsymm2);
+    for (size_t p = 0; p < nPoints; ++p)
+        HessianUncertaintyFromSums(values[p * nMembers], errplus2[p], errminus2[p], errsymm2[p],
+                                   uncertainties[p]);
+}
+} // namespace
+
 void HessianStrategy::Uncertainty(const std::vector<double> &values, const int numCoreErrMember,
                                   const double cl, PDFUncertainty &uncertainty)
 {
-    // Calculate the asymmetric and symmetric Hessian uncertainties
-    // using Eqs. (2.1), (2.2) and (2.6) of arXiv:1106.5788v2.
-    double errplus = 0, errminus = 0, errsymm = 0;
-    for (size_t ieigen = 1; ieigen <= numCoreErrMember / 2; ieigen++)
-    {
-        errplus += SQR(std::max(
-            std::max(values[2 * ieigen - 1] - values[0], values[2 * ieigen] - values[0]), 0.0));
-        errminus += SQR(std::max(
-            std::max(values[0] - values[2 * ieigen - 1], values[0] - values[2 * ieigen]), 0.0));
-        errsymm += SQR(values[2 * ieigen - 1] - values[2 * ieigen]);
-    }
-    uncertainty.errsymm = 0.5 * std::sqrt(errsymm);
-    uncertainty.errplus = std::sqrt(errplus);
-    uncertainty.errminus = std::sqrt(errminus);
-    uncertainty.central = values[0];
+    HessianUncertaintyRow(values.data(), numCoreErrMember, uncertainty);
 }
 
 double HessianStrategy::Correlation(const std::vector<double> &valuesA,
                                     const std::vector<double> &valuesB, const int numCoreErrMember)
 {
     PDFUncertainty errA;
-    Uncertainty(valuesA, numCoreErrMember, -1, errA);
+    HessianUncertaintyRow(valuesA.data(), numCoreErrMember, errA);
     PDFUncertainty errB;
-    Uncertainty(valuesB, numCoreErrMember, -1, errB);
-    double cor = 0.0;
-    // Calculate the correlation over asymm Hessian vectors using Eq. (2.5) of arXiv:1106.5788
-    for (size_t ieigen = 1; ieigen < numCoreErrMember / 2 + 1; ieigen++)
-    {
-        cor += (valuesA[2 * ieigen - 1] - valuesA[2 * ieigen]) *
-               (valuesB[2 * ieigen - 1] - valuesB[2 * ieigen]);
-    }
-    cor /= 4.0 * errA.errsymm * errB.errsymm;
-    return cor;
+    HessianUncertaintyRow(valuesB.data(), numCoreErrMember, errB);
+    return HessianCorrelationRow(valuesA.data(), valuesB.data(), numCoreErrMember, errA.errsymm,
+                                 errB.errsymm);
+}
+
+void HessianStrategy::Uncertainty(const std::vector<double> &values, size_t nPoints,
+                                  const int numCoreErrMember, const double cl,
+                                  std::vector<PDFUncertainty> &uncertainties)
+{
+    uncertainties.resize(nPoints);
+    if (nPoints == 0)
+        return;
+    HessianUncertaintyBlock(values, nPoints, values.size() / nPoints, numCoreErrMember,
+                            uncertainties);
+}
+
+void HessianStrategy::Correlation(const std::vector<double> &valuesA,
+                                  const std::vector<double> &valuesB, size_t nPoints,
+                                  const int numCoreErrMember, std::vector<double> &correlations)
+{
+    correlations.resize(nPoints);
+    if (nPoints == 0)
+        return;
+    const size_t nMembers = valuesA.size() / nPoints;
+    std::vector<PDFUncertainty> errA(nPoints), errB(nPoints);
+    HessianUncertaintyBlock(valuesA, nPoints, nMembers, numCoreErrMember, errA);
+    HessianUncertaintyBlock(valuesB, nPoints, nMembers, numCoreErrMember, errB);
+    for (size_t p = 0; p < nPoints; ++p)
+        correlations[p] =
+            HessianCorrelationRow(valuesA.data() + p * nMembers, valuesB.data() + p * nMembers,
+                                  numCoreErrMember, errA[p].errsymm, errB[p].errsymm);
 }
-} // namespace PDFxTMD
\ No newline at end of file
+} // namespace PDFxTMD
@@ -1,36 +1,95 @@
 #include <PDFxTMDLib/Common/PartonUtils.h>
+#include <PDFxTMDLib/Uncertainty/HessianKernels.h>
 #include <PDFxTMDLib/Uncertainty/SymmHessianStrategy.h>
 #include <cmath>
+#include <vector>
 
 namespace PDFxTMD
 {
+namespace
+{
+void SymmHessianUncertaintyFromSum(double central, double errsymm2, PDFUncertainty &uncertainty)
+{
+    const double errsymm = std::sqrt(errsymm2);
+    uncertainty.errplus = uncertainty.errminus = uncertainty.errsymm = errsymm;
+    uncertainty.central = central;
+}
+
+void SymmHessianUncertaintyRow(const double *values, const int numCoreErrMember,
+                               PDFUncertainty &uncertainty)
+{
+    double errsymm2 = 0;
+    SymmHessianQuadratureSums(values, 1, numCoreErrMember + 1, numCoreErrMember, &errsymm2);
+    SymmHessianUncertaintyFromSum(values[0], errsymm2, uncertainty);
+}
+
+// Calculate the correlation over symmetrised Hessian vectors
+double SymmHessianCorrelationRow(const double *valuesA, const double *valuesB,
+                                 const int numCoreErrMember, double errsymmA, double errsymmB)
+{
+    double cor = SymmHessianDeviationDot(valuesA, valuesB, numCoreErrMember);
+    cor /= errsymmA * errsymmB;
+    return cor;
+}
+
+/// Uncertainties of every row of a points x members block, from one call of the block kernel
+void SymmHessianUncertaintyBlock(const std::vector<double> &values, size_t nPoints,
+                                 size_t nMembers, const int numCoreErrMember,
+                                 std::vector<PDFUncertainty> &uncertainties)
+{
+    std::vector<double> errsymm2(nPoints);
+    SymmHessianQuadratureSums(values.data(), nPoints, nMembers, numCoreErrMember,
+                              errsymm2.data());
+    for (size_t p = 0; p < nPoints; ++p)
+        SymmHessianUncertaintyFromSum(values[p * nMembers], errsymm2[p], uncertainties[p]);
+}
+} // namespace
+
 void SymmHessianStrategy::Uncertainty(const std::vector<double> &values, const int numCoreErrMember,
                                       const double cl, PDFUncertainty &uncertainty)
 {
-    double errsymm = 0;
-    for (size_t ieigen = 1; ieigen <= numCoreErrMember; ieigen++)
-    {
-        errsymm += SQR(values[ieigen] - values[0]);
-    }
-    errsymm = std::sqrt(errsymm);
-    uncertainty.errplus = uncertainty.errminus = uncertainty.errsymm = errsymm;
-    uncertainty.central = values[0];
+    SymmHessianUncertaintyRow(values.data(), numCoreErrMember, uncertainty);
 }
+
 double SymmHessianStrategy::Correlation(const std::vector<double> &valuesA,
                                         const std::vector<double> &valuesB,
                                         const int numCoreErrMember)
 {
-    double cor = 0.;
     PDFUncertainty errA;
-    Uncertainty(valuesA, numCoreErrMember, -1, errA);
+    SymmHessianUncertaintyRow(valuesA.data(), numCoreErrMember, errA);
     PDFUncertainty errB;
-    Uncertainty(valuesB, numCoreErrMember, -1, errB);
-    // Calculate the correlation over symmetrised Hessian vectors
-    for (size_t ieigen = 1; ieigen < numCoreErrMember + 1; ieigen++)
-    {
-        cor += (valuesA[ieigen] - errA.central) * (valuesB[ieigen] - errB.central);
-    }
-    cor /= errA.errsymm * errB.errsymm;
-    return cor;
+    SymmHessianUncertaintyRow(valuesB.data(), numCoreErrMember, errB);
+    return SymmHessianCorrelationRow(valuesA.data(), valuesB.data(), numCoreErrMember,
+                                     errA.errsymm, errB.errsymm);
+}
+
+void SymmHessianStrategy::Uncertainty(const std::vector<double> &values, size_t nPoints,
+                                      const int numCoreErrMember, const double cl,
+                                      std::vector<PDFUncertainty> &uncertainties)
+{
+    uncertainties.resize(nPoints);
+    if (nPoints == 0)
+        return;
+    SymmHessianUncertaintyBlock(values, nPoints, values.size() / nPoints, numCoreErrMember,
+                                uncertainties);
+}
+
+void SymmHessianStrategy::Correlation(const std::vector<double> &valuesA,
+                                      const std::vector<double> &valuesB, size_t nPoints,
+                                      const int numCoreErrMember,
+                                      std::vector<double> &correlations)
+{
+    correlations.resize(nPoints);
+    if (nPoints == 0)
+        return;
+    const size_t nMembers = valuesA.size() / nPoints;
+    std::vector<PDFUncertainty> errA(nPoints), errB(nPoints);
+    SymmHessianUncertaintyBlock(valuesA, nPoints, nMembers, numCoreErrMember, errA);
+    SymmHessianUncertaintyBlock(valuesB, nPoints, nMembers, numCoreErrMember, errB);
+    for (size_t p = 0; p < nPoints; ++p)
+        correlations[p] = SymmHessianCorrelationRow(valuesA.data() + p * nMembers,
+                                                    valuesB.data() + p * nMembers,
+                                                    numCoreErrMember, errA[p].errsymm,
+                                                    errB[p].errsymm);
 }
-} // namespace PDFxTMD
\ No newline at end of file
+} // namespace PDFxTMD
@@ -0,0 +1,150 @@
+// Command line front end of SyntheticSets: writes one synthetic set into a directory, e.g.
+//   PDFxTMD_synthetic_set --name Stress --members 1000 --x 1e-6:1:500 --q 1:1e4:500
+#include "SyntheticSets.h"
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+using namespace PDFxTMD::Synthetic;
+
+const char *USAGE = R"(Usage: PDFxTMD_synthetic_set --name NAME [options]
+
+Writes NAME/NAME.info and NAME/NAME_XXXX.dat into the output directory.
+
+Options:
+  --output DIR          directory of the set (default: .)
+  --format FORMAT       lhagrid1, lhagrid_tmd1 or allflavorUpdf (default: lhagrid1)
+  --members N           number of members (default: 1)
+  --error-type TYPE     hessian, symmhessian or replicas (default: hessian)
+  --alphas-type TYPE    ipol, ode or analytic (default: ipol)
+  --interpolator NAME   interpolator written to the info file
+  --tmd-scheme SCHEME   "PB TMD" or "PB TMD-EW" (default: "PB TMD")
+  --flavors A,B,...     flavors with a grid (default: -5,-4,-3,-2,-1,21,1,2,3,4,5)
+  --x MIN:MAX:N         x knots (default: 1e-6:1:100, allflavorUpdf: 1e-6:0.99:100)
+  --kt MIN:MAX:N        kt knots of TMD sets (default: 0.01:100:30)
+  --q MIN:MAX:N         a subgrid in Q; repeat for several subgrids
+                        (default: 1:1e4:50, allflavorUpdf: 1.1:1e4:50)
+  --form FORM           valence (Gaussian in kt for TMDs) or loglinear (default: valence)
+  --precision DIGITS    digits after the decimal point, 16 for exact values (default: 8)
+)";
+
+Axis ParseAxis(const std::string &text)
+{
+    Axis axis{};
+    char colon1 = 0, colon2 = 0;
+    std::istringstream stream(text);
+    if (!(stream >> axis.min >> colon1 >> axis.max >> colon2 >> axis.knots) || colon1 != ':' ||
+        colon2 != ':' || !stream.eof())
+        throw std::invalid_argument("Expected MIN:MAX:N instead of " + text);
+    return axis;
+}
+
+std::vector<int> ParseFlavors(const std::string &text)
+{
+    std::vector<int> flavors;
+    std::istringstream stream(text);
+    std::string flavor;
+    while (std::getline(stream, flavor, ','))
+        flavors.push_back(std::stoi(flavor));
+    return flavors;
+}
+
+SyntheticSet ParseArguments(int argc, char **argv, std::string &output)
+{
+    SyntheticSet set;
+    bool customX = false, customQ = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string option = argv[i];
+        if (i + 1 == argc)
+            throw std::invalid_argument("Missing value of " + option);
+        const std::string value = argv[++i];
+        if (option == "--name")
+            set.name = value;
+        else if (option == "--output")
+            output = value;
+        else if (option == "--format")
+            set.format = value;
+        else if (option == "--members")
+            set.nMembers = std::stoi(value);
+        else if (option == "--error-type")
+            set.errorType = value;
+        else if (option == "--alphas-type")
+            set.alphasType = value;
+        else if (option == "--interpolator")
+            set.interpolator = value;
+        else if (option == "--tmd-scheme")
+            set.tmdScheme = value;
+        else if (option == "--flavors")
+            set.flavors = ParseFlavors(value);
+        else if (option == "--x")
+        {
+            customX = true;
+            set.x = ParseAxis(value);
+        }
+        else if (option == "--kt")
+            set.kt = ParseAxis(value);
+        else if (option == "--q")
+        {
+            if (!customQ)
+                set.q.clear();
+            customQ = true;
+            set.q.push_back(ParseAxis(value));
+        }
+        else if (option == "--precision")
+            set.precision = std::stoi(value);
+        else if (option == "--form")
+        {
+            if (value == "valence")
+            {
+                set.collinearForm = ValenceCollinearForm();
+                set.tmdForm = GaussianTMDForm();
+            }
+            else if (value == "loglinear")
+            {
+                set.collinearForm = LogLinearCollinearForm();
+                set.tmdForm = LogLinearTMDForm();
+            }
+            else
+                throw std::invalid_argument("Unknown form " + value);
+        }
+        else
+            throw std::invalid_argument("Unknown option " + option);
+    }
+    // The default axes have knots at x = 1 and Q = 1, which allflavorUpdf grids cannot hold
+    if (set.format == "allflavorUpdf")
+    {
+        if (!customX)
+            set.x = ALLFLAVOR_UPDF_X;
+        if (!customQ)
+            set.q = {ALLFLAVOR_UPDF_Q};
+    }
+    return set;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")
+    {
+        std::cout << USAGE;
+        return argc < 2 ? 1 : 0;
+    }
+    try
+    {
+        std::string output = ".";
+        const SyntheticSet set = ParseArguments(argc, argv, output);
+        WriteSyntheticSet(output, set);
+        std::cout << "Wrote " << set.nMembers << " members of " << set.name << " to "
+                  << (std::filesystem::path(output) / set.name).string() << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << "\n\n" << USAGE;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,369 @@
+#include "SyntheticSets.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace PDFxTMD::Synthetic
+{
+namespace
+{
+/// Columns of allflavorUpdf files after log(x), log(kt2) and log(mu), as TDefaultAllFlavorReader
+/// reads them; 100 to 103 are PartonFlavor::z0, wplus, wminus and higgs of PB TMD-EW sets
+const std::vector<int> ALL_FLAVOR_COLUMNS = {-6, -5, -4, -3, -2, -1, 21, 1, 2, 3, 4, 5, 6, 22};
+const std::vector<int> ALL_FLAVOR_EW_COLUMNS = {100, 101, 102, 103};
+
+std::vector<int> AllFlavorColumns(const SyntheticSet &set)
+{
+    std::vector<int> columns = ALL_FLAVOR_COLUMNS;
+    if (set.tmdScheme == "PB TMD-EW")
+        columns.insert(columns.end(), ALL_FLAVOR_EW_COLUMNS.begin(), ALL_FLAVOR_EW_COLUMNS.end());
+    return columns;
+}
+
+class Writer
+{
+  public:
+    Writer(const std::filesystem::path &path, int precision)
+        : m_path(path), m_file(path), m_precision(precision)
+    {
+        if (!m_file)
+            throw std::runtime_error("Cannot write " + path.string());
+    }
+    Writer &operator<<(const std::string &text)
+    {
+        m_file << text;
+        return *this;
+    }
+    void Line(const std::vector<double> &values)
+    {
+        char buffer[40];
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const int length = std::snprintf(buffer, sizeof(buffer), i ? " %.*e" : "%.*e",
+                                             m_precision, values[i]);
+            m_file.write(buffer, length);
+        }
+        m_file << '\n';
+    }
+    /// Flushes the file, so that a full disk is reported instead of truncating the set
+    void Close()
+    {
+        m_file.close();
+        if (!m_file)
+            throw std::runtime_error("Cannot write " + m_path.string());
+    }
+
+  private:
+    std::filesystem::path m_path;
+    std::ofstream m_file;
+    int m_precision;
+};
+
+std::string Number(double value, int precision)
+{
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "%.*e", precision, value);
+    return buffer;
+}
+
+std::string List(const std::vector<double> &values, int precision)
+{
+    std::string text = "[";
+    for (size_t i = 0; i < values.size(); ++i)
+        text += (i ? ", " : "") + Number(values[i], precision);
+    return text + "]";
+}
+
+/// @p pids joined by @p separator
+std::string Join(const std::vector<int> &pids, const std::string &separator)
+{
+    std::string text;
+    for (size_t i = 0; i < pids.size(); ++i)
+        text += (i ? separator : "") + std::to_string(pids[i]);
+    return text;
+}
+
+bool Contains(const std::vector<int> &pids, int pid)
+{
+    return std::find(pids.begin(), pids.end(), pid) != pids.end();
+}
+
+void CheckAxis(const Axis &axis, const std::string &name)
+{
+    if (!(axis.min > 0 && axis.min < axis.max) || axis.knots < 2)
+        throw std::invalid_argument("The " + name +
+                                    " axis needs 0 < min < max and at least two knots");
+}
+
+/// allflavorUpdf files store the logarithms of the knots and reserve 0 for invalid lines
+void CheckNoUnitKnot(const std::vector<double> &knots, const std::string &name)
+{
+    if (std::find(knots.begin(), knots.end(), 1.0) != knots.end())
+        throw std::invalid_argument("allflavorUpdf grids cannot have a knot at " + name + " = 1");
+}
+
+void Check(const SyntheticSet &set)
+{
+    if (set.name.empty())
+        throw std::invalid_argument("The set needs a name");
+    if (set.format != "lhagrid1" && set.format != "lhagrid_tmd1" && set.format != "allflavorUpdf")
+        throw std::invalid_argument("Unknown format " + set.format);
+    if (set.nMembers < 1)
+        throw std::invalid_argument("The set needs at least one member");
+    if (set.precision < 1 || set.precision > 17)
+        throw std::invalid_argument("The precision must be between 1 and 17 digits");
+    if (set.alphasType != "ipol" && set.alphasType != "ode" && set.alphasType != "analytic")
+        throw std::invalid_argument("Unknown AlphaS_Type " + set.alphasType);
+    if (set.flavors.empty())
+        throw std::invalid_argument("The set needs at least one flavor");
+    CheckAxis(set.x, "x");
+    if (set.q.empty())
+        throw std::invalid_argument("The set needs at least one subgrid in Q");
+    for (size_t i = 0; i < set.q.size(); ++i)
+    {
+        CheckAxis(set.q[i], "Q");
+        if (i > 0 && set.q[i].min != set.q[i - 1].max)
+            throw std::invalid_argument("Each subgrid in Q must start where the previous ends");
+    }
+    if (!set.IsTMD())
+        return;
+
+    CheckAxis(set.kt, "kt");
+    if (set.q.size() > 1)
+        throw std::invalid_argument(set.format + " grids have a single subgrid in Q");
+    if (set.tmdScheme != "PB TMD" && set.tmdScheme != "PB TMD-EW")
+        throw std::invalid_argument("Unknown TMDScheme " + set.tmdScheme);
+    if (set.format == "allflavorUpdf")
+    {
+        const std::vector<int> columns = AllFlavorColumns(set);
+        for (int pid : set.flavors)
+            if (!Contains(columns, pid))
+                throw std::invalid_argument("allflavorUpdf files of " + set.tmdScheme +
+                                            " sets have no column for flavor " +
+                                            std::to_string(pid));
+        CheckNoUnitKnot(set.x.Knots(), "x");
+        std::vector<double> kt2s;
+        for (double kt : set.kt.Knots())
+            kt2s.push_back(kt * kt);
+        CheckNoUnitKnot(kt2s, "kt2");
+        CheckNoUnitKnot(set.q.front().Knots(), "Q");
+    }
+}
+
+std::string AlphaSMetadata(const SyntheticSet &set)
+{
+    std::string text = "AlphaS_Type: " + set.alphasType + "\n";
+    text += "AlphaS_MZ: 0.118\nAlphaS_OrderQCD: 2\nAlphaS_FlavorScheme: variable\n"
+            "AlphaS_NumFlavors: 5\n";
+    if (set.alphasType == "analytic")
+        text += "AlphaS_Lambda3: 0.339\nAlphaS_Lambda4: 0.296\nAlphaS_Lambda5: 0.213\n";
+    const std::vector<double> qs = Axis{set.q.front().min, set.q.back().max, 40}.Knots();
+    std::vector<double> alphas;
+    for (double q : qs)
+        alphas.push_back(set.alphas(q * q));
+    text += "AlphaS_Qs: " + List(qs, set.precision) +
+            "\nAlphaS_Vals: " + List(alphas, set.precision) + "\n";
+    return text;
+}
+
+void WriteInfo(const std::filesystem::path &path, const SyntheticSet &set)
+{
+    Writer info(path, set.precision);
+    info << "SetDesc: \"synthetic set\"\nFormat: " + set.format + "\n";
+    if (set.IsTMD())
+        info << "TMDScheme: \"" + set.tmdScheme + "\"\n";
+    info << "NumMembers: " + std::to_string(set.nMembers) + "\n";
+    info << "Flavors: [" + Join(set.flavors, ", ") + "]\nOrderQCD: 2\n";
+    const auto range = [&](const std::string &key, double min, double max) {
+        info << key + "Min: " + Number(min, set.precision) + "\n" + key +
+                    "Max: " + Number(max, set.precision) + "\n";
+    };
+    range("X", set.x.min, set.x.max);
+    range("Q", set.q.front().min, set.q.back().max);
+    if (set.IsTMD())
+        range("Kt", set.kt.min, set.kt.max);
+    info << "ErrorType: " + set.errorType + "\nErrorConfLevel: 68\n";
+    info << "MZ: 91.1876\nMUp: 0\nMDown: 0\nMStrange: 0\nMCharm: 1.51\nMBottom: 4.92\n"
+            "MTop: 172.5\n";
+    info << AlphaSMetadata(set);
+    if (!set.interpolator.empty())
+        info << "Interpolator: " + set.interpolator + "\n";
+    info.Close();
+}
+
+void WriteLHAGridMember(const std::filesystem::path &path, const SyntheticSet &set, int member)
+{
+    const bool isTMD = set.IsTMD();
+    const std::vector<double> xs = set.x.Knots();
+    const std::vector<double> kts = set.kt.Knots();
+    // Collinear grids have no kt axis; a single dummy knot keeps one loop for both formats
+    const std::vector<double> ktLoop = isTMD ? kts : std::vector<double>{0.};
+    const char *pdfType = member == 0 ? "central" : set.errorType == "replicas" ? "replica"
+                                                                               : "error";
+    Writer data(path, set.precision);
+    data << "PdfType: " + std::string(pdfType) + "\nFormat: " + set.format + "\n---\n";
+    std::vector<double> row(set.flavors.size());
+    for (const Axis &subgrid : set.q)
+    {
+        const std::vector<double> qs = subgrid.Knots();
+        data.Line(xs);
+        if (isTMD)
+            data.Line(kts);
+        data.Line(qs);
+        data << Join(set.flavors, " ") + "\n";
+        for (double x : xs)
+            for (double kt : ktLoop)
+                for (double q : qs)
+                {
+                    for (size_t i = 0; i < set.flavors.size(); ++i)
+                        row[i] = isTMD ? kt * kt * set.tmdForm(set.flavors[i], x, kt * kt, q * q,
+                                                               member)
+                                       : set.collinearForm(set.flavors[i], x, q * q, member);
+                    data.Line(row);
+                }
+        // lhagrid_tmd1 files hold a single block without a closing separator
+        if (!isTMD)
+            data << "---\n";
+    }
+    data.Close();
+}
+
+/// One line per knot: log(x), log(kt2), log(mu) and then kt2 times the form of every column
+void WriteAllFlavorMember(const std::filesystem::path &path, const SyntheticSet &set, int member)
+{
+    const std::vector<int> columns = AllFlavorColumns(set);
+    Writer data(path, set.precision);
+    data << "# Synthetic allflavorUpdf grid, member " + std::to_string(member) + "\n";
+    data << "# TMDScheme: " + set.tmdScheme + "\n";
+    data << "# log(x) log(kt2) log(mu) " + Join(columns, " ") + "\n";
+    data << "#\n";
+    std::vector<double> row(3 + columns.size());
+    for (double x : set.x.Knots())
+        for (double kt : set.kt.Knots())
+            for (double q : set.q.front().Knots())
+            {
+                const double kt2 = kt * kt;
+                row[0] = std::log(x);
+                row[1] = std::log(kt2);
+                row[2] = std::log(q);
+                for (size_t i = 0; i < columns.size(); ++i)
+                    row[3 + i] = Contains(set.flavors, columns[i])
+                                     ? kt2 * set.tmdForm(columns[i], x, kt2, q * q, member)
+                                     : 0;
+                data.Line(row);
+            }
+    data.Close();
+}
+} // namespace
+
+CollinearForm ValenceCollinearForm()
+{
+    return [](int pid, double x, double mu2, int member) {
+        const double shift = 0.003 * member * (member % 2 ? 1 : -1);
+        return (1 + 0.01 * std::abs(pid) + shift) * std::pow(x, 0.3 + 0.01 * pid) *
+               std::pow(1 - x, 3) * (1 + 0.1 * std::log(mu2));
+    };
+}
+
+TMDForm GaussianTMDForm()
+{
+    return [collinear = ValenceCollinearForm()](int pid, double x, double kt2, double mu2,
+                                                int member) {
+        return collinear(pid, x, mu2, member) * std::exp(-kt2 / (1 + 0.1 * mu2));
+    };
+}
+
+CollinearForm LogLinearCollinearForm()
+{
+    return [](int pid, double x, double mu2, int member) {
+        return 10 + 0.1 * pid + 0.01 * member + 0.1 * std::log(x) + 0.05 * std::log(mu2);
+    };
+}
+
+TMDForm LogLinearTMDForm()
+{
+    return [](int pid, double x, double kt2, double mu2, int member) {
+        return (20 + 0.1 * pid + 0.01 * member + 0.1 * std::log(x) + 0.1 * std::log(kt2) +
+                0.05 * std::log(mu2)) /
+               kt2;
+    };
+}
+
+AlphaSForm RunningAlphaS()
+{
+    return [](double mu2) { return 0.118 / (1 + 0.02 * std::log(mu2 / (91.1876 * 91.1876))); };
+}
+
+std::vector<double> Axis::Knots() const
+{
+    std::vector<double> values(knots);
+    for (size_t i = 0; i < knots; ++i)
+        values[i] = min * std::pow(max / min, static_cast<double>(i) / (knots - 1));
+    values.back() = max;
+    return values;
+}
+
+bool SyntheticSet::IsTMD() const
+{
+    return format != "lhagrid1";
+}
+
+double SyntheticSet::Value(int pid, double x, double kt2, double mu2, int member) const
+{
+    if (!Contains(flavors, pid))
+        return 0;
+    return IsTMD() ? tmdForm(pid, x, kt2, mu2, member) : collinearForm(pid, x, mu2, member);
+}
+
+void WriteSyntheticSet(const std::filesystem::path &directory, const SyntheticSet &set)
+{
+    Check(set);
+    const std::filesystem::path folder = directory / set.name;
+    std::filesystem::create_directories(folder);
+    WriteInfo(folder / (set.name + ".info"), set);
+
+    // Members are independent files, so large sets are written by several threads
+    std::atomic<int> nextMember{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    const auto writeMembers = [&] {
+        for (int member = nextMember++; member < set.nMembers; member = nextMember++)
+        {
+            try
+            {
+                // Room for any int, so the name can never be cut off
+                char fileName[sizeof("_-2147483648.dat")];
+                std::snprintf(fileName, sizeof(fileName), "_%04d.dat", member);
+                const std::filesystem::path path = folder / (set.name + fileName);
+                if (set.format == "allflavorUpdf")
+                    WriteAllFlavorMember(path, set, member);
+                else
+                    WriteLHAGridMember(path, set, member);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+                nextMember = set.nMembers;
+            }
+        }
+    };
+    const unsigned nThreads = std::min<unsigned>(std::max(1u, std::thread::hardware_concurrency()),
+                                                 static_cast<unsigned>(set.nMembers));
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < nThreads; ++i)
+        threads.emplace_back(writeMembers);
+    writeMembers();
+    for (auto &thread : threads)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+} // namespace PDFxTMD::Synthetic
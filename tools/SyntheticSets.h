@@ -0,0 +1,92 @@
+/// @file SyntheticSets.h
+/// @brief Writes lhagrid1, lhagrid_tmd1 and allflavorUpdf sets of known analytic functions.
+///
+/// The grids hold the exact values of the forms at their knots, so comparing a loaded member with
+/// SyntheticSet::Value measures the interpolation error alone. Benchmarks and reader stress tests
+/// use these sets instead of downloaded ones.
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace PDFxTMD::Synthetic
+{
+/// x f(x, mu2) of flavor @p pid in member @p member
+using CollinearForm = std::function<double(int pid, double x, double mu2, int member)>;
+/// x f(x, kt2, mu2) of flavor @p pid in member @p member; the TMD formats store kt2 times it
+using TMDForm = std::function<double(int pid, double x, double kt2, double mu2, int member)>;
+/// alpha_s(mu2), tabulated in the info file of sets with AlphaS_Type ipol
+using AlphaSForm = std::function<double(double mu2)>;
+
+/// Smooth valence-like form; each member is shifted slightly so that the members differ
+CollinearForm ValenceCollinearForm();
+/// ValenceCollinearForm times a Gaussian in kt2 whose width grows with mu2
+TMDForm GaussianTMDForm();
+/// Linear in log x and log mu2, so the collinear interpolators reproduce it up to rounding
+CollinearForm LogLinearCollinearForm();
+/// kt2 times it is linear in log x, log kt2 and log mu2, so the TMD interpolators reproduce it
+/// up to rounding
+TMDForm LogLinearTMDForm();
+/// One-loop-like running from alpha_s(MZ) = 0.118
+AlphaSForm RunningAlphaS();
+
+/// @p knots values evenly spaced in log between @p min and @p max
+struct Axis
+{
+    double min;
+    double max;
+    size_t knots;
+
+    std::vector<double> Knots() const;
+};
+
+/// Default x and Q axes of allflavorUpdf sets, whose grids cannot have a knot at 1
+inline const Axis ALLFLAVOR_UPDF_X{1e-6, 0.99, 100};
+inline const Axis ALLFLAVOR_UPDF_Q{1.1, 1e4, 50};
+
+/// Layout, metadata and content of a generated set
+struct SyntheticSet
+{
+    std::string name;
+    /// lhagrid1, lhagrid_tmd1 or allflavorUpdf
+    std::string format = "lhagrid1";
+    int nMembers = 1;
+    /// hessian, symmhessian or replicas
+    std::string errorType = "hessian";
+    /// ipol, ode or analytic
+    std::string alphasType = "ipol";
+    /// Interpolator written to the info file, empty for the default one
+    std::string interpolator;
+    /// PB TMD or PB TMD-EW; the latter adds the electroweak columns to allflavorUpdf files
+    std::string tmdScheme = "PB TMD";
+    /// Flavors with a grid; the remaining fixed columns of allflavorUpdf files are zero
+    std::vector<int> flavors = {-5, -4, -3, -2, -1, 21, 1, 2, 3, 4, 5};
+    /// Knots in x; allflavorUpdf sets need an axis below 1, such as ALLFLAVOR_UPDF_X
+    Axis x{1e-6, 1, 100};
+    /// Knots in kt (not kt2), used by the TMD formats only
+    Axis kt{0.01, 100, 30};
+    /// Subgrids in Q, each starting where the previous one ends; only lhagrid1 takes several.
+    /// allflavorUpdf sets need a subgrid above 1, such as ALLFLAVOR_UPDF_Q.
+    std::vector<Axis> q{{1, 1e4, 50}};
+    /// Forms of the members; they are called from several threads
+    CollinearForm collinearForm = ValenceCollinearForm();
+    TMDForm tmdForm = GaussianTMDForm();
+    AlphaSForm alphas = RunningAlphaS();
+    /// Digits after the decimal point of knots and values; 8 as in LHAPDF sets, 16 to store
+    /// them exactly
+    int precision = 8;
+
+    bool IsTMD() const;
+    /// The value member @p member should return at the point, 0 for flavors without a grid.
+    /// @p kt2 is ignored by collinear sets.
+    double Value(int pid, double x, double kt2, double mu2, int member = 0) const;
+};
+
+/// Writes @p set as directory/name/name.info and one data file per member, spreading the members
+/// over the hardware threads.
+/// @throws std::invalid_argument if the format cannot hold the layout of @p set
+/// @throws std::runtime_error if a file cannot be written
+void WriteSyntheticSet(const std::filesystem::path &directory, const SyntheticSet &set);
+} // namespace PDFxTMD::Synthetic
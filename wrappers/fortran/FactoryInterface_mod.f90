@@ -2,7 +2,26 @@ module FactoryInterface_mod
     use iso_c_binding
     implicit none
 
+    ! Result of the uncertainty routines, matching PDFUncertaintyC in FortranFactoryWrapper.h
+    type, bind(C) :: PDFUncertainty_t
+        real(c_double) :: central, errplus, errminus, errsymm, scale
+        real(c_double) :: errplus_pdf, errminus_pdf, errsymm_pdf
+        real(c_double) :: errplus_par, errminus_par, errsymm_par
+    end type PDFUncertainty_t
+
+    ! Arrays of all flavors hold 13 values ordered as pid -6 to 6, the gluon being element 7.
+    ! Batch routines evaluate n points in one call; all flavors at n points fill an array
+    ! declared as output(13, n).
+    ! Routines with a status argument set it to 0 on success and to a nonzero pdfxtmd_status
+    ! code on failure, in which case handles are c_null_ptr, numbers are zero and
+    ! last_error_message returns the reason.
     interface
+        subroutine last_error_message(message, length) bind(C, name="last_error_message")
+            use iso_c_binding
+            character(kind=c_char), dimension(*), intent(out) :: message
+            integer(c_int), value :: length
+        end subroutine last_error_message
+
         ! Coupling Factory interfaces
         function create_coupling_factory() bind(C, name="create_coupling_factory")
             use iso_c_binding
@@ -28,6 +47,21 @@ module FactoryInterface_mod
             real(c_double), value :: mu2
         end function alphaQCDMu2_wrapper
 
+        subroutine alphaQCDMu2_batch_wrapper(couplingObject, mu2, alphas, n, status) &
+            bind(C, name="alphaQCDMu2_batch_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: couplingObject
+            real(c_double), dimension(*), intent(in) :: mu2
+            real(c_double), dimension(*), intent(out) :: alphas
+            integer(c_int), value :: n
+            integer(c_int), intent(out) :: status
+        end subroutine alphaQCDMu2_batch_wrapper
+
+        subroutine delete_coupling(couplingObject) bind(C, name="delete_coupling")
+            use iso_c_binding
+            type(c_ptr), value :: couplingObject
+        end subroutine delete_coupling
+
         ! TMD Factory interfaces
         function create_tmd_factory() bind(C, name="create_tmd_factory")
             use iso_c_binding
@@ -57,6 +91,46 @@ module FactoryInterface_mod
             real(c_double), value :: mu2
         end function tmd_wrapper
 
+        subroutine tmd_all_wrapper(tmd, x, kt2, mu2, output, status) bind(C, name="tmd_all_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: tmd
+            real(c_double), value :: x
+            real(c_double), value :: kt2
+            real(c_double), value :: mu2
+            real(c_double), dimension(13), intent(out) :: output
+            integer(c_int), intent(out) :: status
+        end subroutine tmd_all_wrapper
+
+        subroutine tmd_batch_wrapper(tmd, flavor, x, kt2, mu2, output, n, status) &
+            bind(C, name="tmd_batch_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: tmd
+            integer(c_int), value :: flavor
+            real(c_double), dimension(*), intent(in) :: x
+            real(c_double), dimension(*), intent(in) :: kt2
+            real(c_double), dimension(*), intent(in) :: mu2
+            real(c_double), dimension(*), intent(out) :: output
+            integer(c_int), value :: n
+            integer(c_int), intent(out) :: status
+        end subroutine tmd_batch_wrapper
+
+        subroutine tmd_all_batch_wrapper(tmd, x, kt2, mu2, output, n, status) &
+            bind(C, name="tmd_all_batch_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: tmd
+            real(c_double), dimension(*), intent(in) :: x
+            real(c_double), dimension(*), intent(in) :: kt2
+            real(c_double), dimension(*), intent(in) :: mu2
+            real(c_double), dimension(13, *), intent(out) :: output
+            integer(c_int), value :: n
+            integer(c_int), intent(out) :: status
+        end subroutine tmd_all_batch_wrapper
+
+        subroutine delete_tmd(tmd) bind(C, name="delete_tmd")
+            use iso_c_binding
+            type(c_ptr), value :: tmd
+        end subroutine delete_tmd
+
         ! CPDF Factory interfaces
         function create_cpdf_factory() bind(C, name="create_cpdf_factory")
             use iso_c_binding
@@ -85,6 +159,171 @@ module FactoryInterface_mod
             real(c_double), value :: x
             real(c_double), value :: mu2
         end function cpdf_wrapper
+
+        subroutine cpdf_all_wrapper(cpdf, x, mu2, output, status) bind(C, name="cpdf_all_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: cpdf
+            real(c_double), value :: x
+            real(c_double), value :: mu2
+            real(c_double), dimension(13), intent(out) :: output
+            integer(c_int), intent(out) :: status
+        end subroutine cpdf_all_wrapper
+
+        subroutine cpdf_batch_wrapper(cpdf, flavor, x, mu2, output, n, status) &
+            bind(C, name="cpdf_batch_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: cpdf
+            integer(c_int), value :: flavor
+            real(c_double), dimension(*), intent(in) :: x
+            real(c_double), dimension(*), intent(in) :: mu2
+            real(c_double), dimension(*), intent(out) :: output
+            integer(c_int), value :: n
+            integer(c_int), intent(out) :: status
+        end subroutine cpdf_batch_wrapper
+
+        subroutine cpdf_all_batch_wrapper(cpdf, x, mu2, output, n, status) &
+            bind(C, name="cpdf_all_batch_wrapper")
+            use iso_c_binding
+            type(c_ptr), value :: cpdf
+            real(c_double), dimension(*), intent(in) :: x
+            real(c_double), dimension(*), intent(in) :: mu2
+            real(c_double), dimension(13, *), intent(out) :: output
+            integer(c_int), value :: n
+            integer(c_int), intent(out) :: status
+        end subroutine cpdf_all_batch_wrapper
+
+        subroutine delete_cpdf(cpdf) bind(C, name="delete_cpdf")
+            use iso_c_binding
+            type(c_ptr), value :: cpdf
+        end subroutine delete_cpdf
+
+        ! PDF set interfaces. Members returned by *_set_member belong to the set and are
+        ! evaluated with the routines above. A negative cl selects the set's native CL.
+        function create_tmd_set(pdfSetName, status) bind(C, name="create_tmd_set")
+            use iso_c_binding
+            type(c_ptr) :: create_tmd_set
+            character(kind=c_char), dimension(*) :: pdfSetName
+            integer(c_int), intent(out) :: status
+        end function create_tmd_set
+
+        subroutine delete_tmd_set(set) bind(C, name="delete_tmd_set")
+            use iso_c_binding
+            type(c_ptr), value :: set
+        end subroutine delete_tmd_set
+
+        function tmd_set_size(set, status) bind(C, name="tmd_set_size")
+            use iso_c_binding
+            integer(c_int) :: tmd_set_size
+            type(c_ptr), value :: set
+            integer(c_int), intent(out) :: status
+        end function tmd_set_size
+
+        function tmd_set_member(set, member, status) bind(C, name="tmd_set_member")
+            use iso_c_binding
+            type(c_ptr) :: tmd_set_member
+            type(c_ptr), value :: set
+            integer(c_int), value :: member
+            integer(c_int), intent(out) :: status
+        end function tmd_set_member
+
+        function tmd_set_alphasQ2(set, mu2, status) bind(C, name="tmd_set_alphasQ2")
+            use iso_c_binding
+            real(c_double) :: tmd_set_alphasQ2
+            type(c_ptr), value :: set
+            real(c_double), value :: mu2
+            integer(c_int), intent(out) :: status
+        end function tmd_set_alphasQ2
+
+        subroutine tmd_set_uncertainty(set, flavor, x, kt2, mu2, cl, result, status) &
+            bind(C, name="tmd_set_uncertainty")
+            use iso_c_binding
+            import :: PDFUncertainty_t
+            type(c_ptr), value :: set
+            integer(c_int), value :: flavor
+            real(c_double), value :: x
+            real(c_double), value :: kt2
+            real(c_double), value :: mu2
+            real(c_double), value :: cl
+            type(PDFUncertainty_t), intent(out) :: result
+            integer(c_int), intent(out) :: status
+        end subroutine tmd_set_uncertainty
+
+        subroutine tmd_set_uncertainty_batch(set, flavor, x, kt2, mu2, n, cl, result, status) &
+            bind(C, name="tmd_set_uncertainty_batch")
+            use iso_c_binding
+            import :: PDFUncertainty_t
+            type(c_ptr), value :: set
+            integer(c_int), value :: flavor
+            real(c_double), dimension(*), intent(in) :: x
+            real(c_double), dimension(*), intent(in) :: kt2
+            real(c_double), dimension(*), intent(in) :: mu2
+            integer(c_int), value :: n
+            real(c_double), value :: cl
+            type(PDFUncertainty_t), dimension(*), intent(out) :: result
+            integer(c_int), intent(out) :: status
+        end subroutine tmd_set_uncertainty_batch
+
+        function create_cpdf_set(pdfSetName, status) bind(C, name="create_cpdf_set")
+            use iso_c_binding
+            type(c_ptr) :: create_cpdf_set
+            character(kind=c_char), dimension(*) :: pdfSetName
+            integer(c_int), intent(out) :: status
+        end function create_cpdf_set
+
+        subroutine delete_cpdf_set(set) bind(C, name="delete_cpdf_set")
+            use iso_c_binding
+            type(c_ptr), value :: set
+        end subroutine delete_cpdf_set
+
+        function cpdf_set_size(set, status) bind(C, name="cpdf_set_size")
+            use iso_c_binding
+            integer(c_int) :: cpdf_set_size
+            type(c_ptr), value :: set
+            integer(c_int), intent(out) :: status
+        end function cpdf_set_size
+
+        function cpdf_set_member(set, member, status) bind(C, name="cpdf_set_member")
+            use iso_c_binding
+            type(c_ptr) :: cpdf_set_member
+            type(c_ptr), value :: set
+            integer(c_int), value :: member
+            integer(c_int), intent(out) :: status
+        end function cpdf_set_member
+
+        function cpdf_set_alphasQ2(set, mu2, status) bind(C, name="cpdf_set_alphasQ2")
+            use iso_c_binding
+            real(c_double) :: cpdf_set_alphasQ2
+            type(c_ptr), value :: set
+            real(c_double), value :: mu2
+            integer(c_int), intent(out) :: status
+        end function cpdf_set_alphasQ2
+
+        subroutine cpdf_set_uncertainty(set, flavor, x, mu2, cl, result, status) &
+            bind(C, name="cpdf_set_uncertainty")
+            use iso_c_binding
+            import :: PDFUncertainty_t
+            type(c_ptr), value :: set
+            integer(c_int), value :: flavor
+            real(c_double), value :: x
+            real(c_double), value :: mu2
+            real(c_double), value :: cl
+            type(PDFUncertainty_t), intent(out) :: result
+            integer(c_int), intent(out) :: status
+        end subroutine cpdf_set_uncertainty
+
+        subroutine cpdf_set_uncertainty_batch(set, flavor, x, mu2, n, cl, result, status) &
+            bind(C, name="cpdf_set_uncertainty_batch")
+            use iso_c_binding
+            import :: PDFUncertainty_t
+            type(c_ptr), value :: set
+            integer(c_int), value :: flavor
+            real(c_double), dimension(*), intent(in) :: x
+            real(c_double), dimension(*), intent(in) :: mu2
+            integer(c_int), value :: n
+            real(c_double), value :: cl
+            type(PDFUncertainty_t), dimension(*), intent(out) :: result
+            integer(c_int), intent(out) :: status
+        end subroutine cpdf_set_uncertainty_batch
     end interface
 
 end module FactoryInterface_mod 
\ No newline at end of file
@@ -1,20 +1,226 @@
+#include "PDFxTMDLib/Common/AllFlavorsShape.h"
 #include "PDFxTMDLib/Common/ConfigWrapper.h"
+#include "PDFxTMDLib/Common/Instrumentation.h"
 #include "PDFxTMDLib/Common/PartonUtils.h"
+#include "PDFxTMDLib/Common/ThreadPool.h"
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlErrorInfo.h"
 #include "PDFxTMDLib/Common/YamlMetaInfo/YamlStandardPDFInfo.h"
+#include "PDFxTMDLib/ConcretePDF.h"
 #include "PDFxTMDLib/Factory.h"
 #include "PDFxTMDLib/Interface/ICPDF.h"
 #include "PDFxTMDLib/Interface/IQCDCoupling.h"
 #include "PDFxTMDLib/Interface/ITMD.h"
 #include "PDFxTMDLib/PDFSet.h"
+#include <algorithm>
 #include <array>
+#include <memory>
+#include <mutex>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace py = pybind11;
 
+namespace
+{
+/// Contiguous float64 array; arrays of other numeric types and Python scalars are converted.
+using DoubleArray = py::array_t<double, py::array::c_style | py::array::forcecast>;
+/// Contiguous array of parton flavor codes
+using FlavorArray = py::array_t<int, py::array::c_style | py::array::forcecast>;
+
+/// Broadcasts the arrays against each other, as NumPy ufuncs do.
+template <typename... Arrays> py::sequence Broadcast(const Arrays &...arrays)
+{
+    return py::module_::import("numpy").attr("broadcast_arrays")(arrays...);
+}
+
+/// Contiguous copy of a broadcast array, or the array itself if it already is contiguous.
+template <typename T>
+py::array_t<T, py::array::c_style | py::array::forcecast> Contiguous(const py::object &array)
+{
+    auto result = py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(array);
+    if (!result)
+        throw std::invalid_argument("Arguments must be numbers or arrays of numbers");
+    return result;
+}
+
+std::vector<py::ssize_t> ShapeOf(const py::array &array)
+{
+    return std::vector<py::ssize_t>(array.shape(), array.shape() + array.ndim());
+}
+
+/// Names the failing point in an error message.
+std::string PointSuffix(size_t i)
+{
+    return " (point " + std::to_string(i) + ")";
+}
+
+/// Applies the checks of the scalar bindings to every point; kt2 may be null for cPDFs.
+void ValidatePoints(const double *x, const double *kt2, const double *mu2, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (x[i] <= 0 || x[i] >= 1)
+            throw std::invalid_argument("Momentum fraction x must be in (0, 1), got " +
+                                        std::to_string(x[i]) + PointSuffix(i));
+        if (kt2 && kt2[i] < 0)
+            throw std::invalid_argument(
+                "Transverse momentum squared kt2 must be non-negative, got " +
+                std::to_string(kt2[i]) + PointSuffix(i));
+        if (mu2[i] <= 0)
+            throw std::invalid_argument(
+                "Factorization scale squared mu2 must be positive, got " +
+                std::to_string(mu2[i]) + PointSuffix(i));
+    }
+}
+
+void ValidateFlavors(const int *flavors, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        if (flavors[i] != PDFxTMD::PartonFlavor::g && (flavors[i] < -6 || flavors[i] > 6))
+            throw std::invalid_argument("Unknown parton flavor " + std::to_string(flavors[i]) +
+                                        PointSuffix(i));
+}
+
+/// Smallest chunk of points handed to a worker by the n_threads overloads
+constexpr size_t MinPointsPerTask = 256;
+
+/**
+ * Evaluates fn(begin, end) over the points [0, n) on up to @p nThreads threads, zero meaning one
+ * per hardware thread. The workers belong to the module rather than to the library's global pool,
+ * so n_threads has no effect on how PDF sets are evaluated elsewhere; the pool grows to the largest
+ * n_threads requested. Every chunk writes its own range of the output, and the evaluation state
+ * lives on the stack of the thread running it. Called with the GIL released.
+ */
+void ParallelPoints(size_t n, size_t nThreads, size_t grain,
+                    const PDFxTMD::ThreadPool::RangeFunction &fn)
+{
+    if (nThreads == 0)
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (nThreads == 1)
+    {
+        fn(0, n);
+        return;
+    }
+    static std::mutex poolMutex;
+    static std::shared_ptr<PDFxTMD::ThreadPool> pool;
+    std::shared_ptr<PDFxTMD::ThreadPool> workers;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (!pool || pool->size() + 1 < nThreads)
+            pool = std::make_shared<PDFxTMD::ThreadPool>(nThreads - 1);
+        workers = pool;
+    }
+    workers->ParallelFor(n, grain, fn, nThreads);
+}
+
+/// Uncertainties at every point as a dict of arrays of @p shape, keyed by PDFUncertainty field
+py::dict UncertaintyArrays(const std::vector<PDFxTMD::PDFUncertainty> &uncertainties,
+                           const std::vector<py::ssize_t> &shape)
+{
+    using Field = double PDFxTMD::PDFUncertainty::*;
+    const std::pair<const char *, Field> fields[] = {
+        {"central", &PDFxTMD::PDFUncertainty::central},
+        {"errplus", &PDFxTMD::PDFUncertainty::errplus},
+        {"errminus", &PDFxTMD::PDFUncertainty::errminus},
+        {"errsymm", &PDFxTMD::PDFUncertainty::errsymm},
+        {"scale", &PDFxTMD::PDFUncertainty::scale},
+        {"errplus_pdf", &PDFxTMD::PDFUncertainty::errplus_pdf},
+        {"errminus_pdf", &PDFxTMD::PDFUncertainty::errminus_pdf},
+        {"errsymm_pdf", &PDFxTMD::PDFUncertainty::errsymm_pdf},
+        {"errplus_par", &PDFxTMD::PDFUncertainty::errplus_par},
+        {"errminus_par", &PDFxTMD::PDFUncertainty::errminus_par},
+        {"errsymm_par", &PDFxTMD::PDFUncertainty::errsymm_par}};
+    py::dict result;
+    for (const auto &field : fields)
+    {
+        DoubleArray values(shape);
+        double *data = values.mutable_data();
+        for (size_t i = 0; i < uncertainties.size(); ++i)
+            data[i] = uncertainties[i].*field.second;
+        result[field.first] = values;
+    }
+    return result;
+}
+
+/// Uncertainty of @p flavor at the broadcast points (x, [kt2,] mu2) of a set
+template <typename Tag, typename... Arrays>
+py::dict UncertaintyOnArrays(PDFxTMD::PDFSet<Tag> &self, PDFxTMD::PartonFlavor flavor,
+                             double cl, size_t nThreads, const Arrays &...arrays)
+{
+    const py::sequence points = Broadcast(arrays...);
+    std::array<DoubleArray, sizeof...(Arrays)> kinematics;
+    for (size_t i = 0; i < kinematics.size(); ++i)
+        kinematics[i] = Contiguous<double>(points[i]);
+    const size_t n = static_cast<size_t>(kinematics[0].size());
+    std::vector<PDFxTMD::PDFUncertainty> uncertainties(n);
+    const double *x = kinematics[0].data(), *mu2 = kinematics[sizeof...(Arrays) - 1].data();
+    const double *kt2 = sizeof...(Arrays) == 3 ? kinematics[1].data() : nullptr;
+    ValidatePoints(x, kt2, mu2, n);
+    {
+        py::gil_scoped_release release;
+        // With one thread the set spreads members over the global pool as usual; chunks of
+        // points evaluate their members serially.
+        ParallelPoints(n, nThreads, 1, [&](size_t begin, size_t end) {
+            std::vector<PDFxTMD::PDFUncertainty> chunk;
+            if constexpr (sizeof...(Arrays) == 3)
+                self.Uncertainty(flavor, x + begin, kt2 + begin, mu2 + begin, end - begin, cl,
+                                 chunk);
+            else
+                self.Uncertainty(flavor, x + begin, mu2 + begin, end - begin, cl, chunk);
+            std::move(chunk.begin(), chunk.end(), uncertainties.begin() + begin);
+        });
+    }
+    return UncertaintyArrays(uncertainties, ShapeOf(kinematics[0]));
+}
+
+/// Read-only array over @p data, kept valid by holding a reference to @p owner. The strides are
+/// given in elements.
+py::array ReadOnlyView(const double *data, std::vector<py::ssize_t> shape,
+                       std::vector<py::ssize_t> strides, py::handle owner)
+{
+    for (py::ssize_t &stride : strides)
+        stride *= static_cast<py::ssize_t>(sizeof(double));
+    py::array view(py::dtype::of<double>(), std::move(shape), std::move(strides), data, owner);
+    view.attr("setflags")(py::arg("write") = false);
+    return view;
+}
+
+py::array VectorView(const std::vector<double> &values, py::handle owner)
+{
+    return ReadOnlyView(values.data(), {static_cast<py::ssize_t>(values.size())}, {1}, owner);
+}
+
+/// alpha_s of a set at every element of @p q2, through the batch path of its coupling
+template <typename Tag>
+DoubleArray AlphasQ2OnArray(const PDFxTMD::PDFSet<Tag> &self, const DoubleArray &q2,
+                            size_t nThreads)
+{
+    const size_t n = static_cast<size_t>(q2.size());
+    const double *scales = q2.data();
+    for (size_t i = 0; i < n; ++i)
+        if (scales[i] <= 0)
+            throw std::invalid_argument("Scale Q^2 must be positive, got " +
+                                        std::to_string(scales[i]) + " (point " +
+                                        std::to_string(i) + ")");
+    DoubleArray alphas(ShapeOf(q2));
+    double *output = alphas.mutable_data();
+    {
+        py::gil_scoped_release release;
+        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t begin, size_t end) {
+            self.alphasQ2(scales + begin, output + begin, end - begin);
+        });
+    }
+    return alphas;
+}
+} // namespace
+
 PYBIND11_MODULE(pdfxtmd, m)
 {
     m.doc() = "Python bindings for the PDFxTMD library, providing access to Collinear Parton "
@@ -98,6 +304,85 @@ PYBIND11_MODULE(pdfxtmd, m)
                 }
             },
             py::arg("pdfSetName"), py::arg("setMember"), py::return_value_policy::take_ownership);
+    // Loaded grids, exposed as read-only NumPy views that keep their PDF object alive
+    using Shape = PDFxTMD::DefaultAllFlavorShape;
+    using TMDShape = PDFxTMD::DefaultAllFlavorTMDShape;
+    py::class_<Shape>(m, "DefaultAllFlavorShape",
+                      "Knots and grid values of a loaded collinear PDF member. Arrays are "
+                      "read-only views of the library's memory, valid while this object lives.")
+        .def_readonly("n_xs", &Shape::n_xs, "Number of x knots")
+        .def_readonly("n_mu2s", &Shape::n_mu2s, "Number of mu2 knots")
+        .def_readonly("n_flavors", &Shape::n_flavors, "Number of flavor columns of the grid")
+        .def_readonly("pids", &Shape::_pids, "PDG code of every flavor column")
+        .def_property_readonly(
+            "x_vec",
+            [](py::object self) { return VectorView(self.cast<const Shape &>().x_vec, self); },
+            "x knots")
+        .def_property_readonly(
+            "mu2_vec",
+            [](py::object self) { return VectorView(self.cast<const Shape &>().mu2_vec, self); },
+            "mu2 knots (GeV^2)")
+        .def_property_readonly(
+            "log_x_vec",
+            [](py::object self) { return VectorView(self.cast<const Shape &>().log_x_vec, self); },
+            "Natural logarithms of the x knots")
+        .def_property_readonly(
+            "log_mu2_vec",
+            [](py::object self) {
+                return VectorView(self.cast<const Shape &>().log_mu2_vec, self);
+            },
+            "Natural logarithms of the mu2 knots")
+        .def_property_readonly(
+            "grids_flat",
+            [](py::object self) {
+                return VectorView(self.cast<const Shape &>().grids_flat, self);
+            },
+            "Grid values x*f of all flavors as one flat array")
+        .def_property_readonly(
+            "grid",
+            [](py::object self) {
+                const Shape &shape = self.cast<const Shape &>();
+                return ReadOnlyView(
+                    shape.grids_flat.data(),
+                    {static_cast<py::ssize_t>(shape.n_xs), static_cast<py::ssize_t>(shape.n_mu2s),
+                     static_cast<py::ssize_t>(shape.n_flavors)},
+                    {static_cast<py::ssize_t>(shape.stride_ix),
+                     static_cast<py::ssize_t>(shape.stride_iq2), 1},
+                    self);
+            },
+            "grids_flat viewed with shape (n_xs, n_mu2s, n_flavors); the last axis follows "
+            "pids.");
+    py::class_<TMDShape, Shape>(m, "DefaultAllFlavorTMDShape",
+                                "Knots and grid values of a loaded TMD member. Arrays are "
+                                "read-only views of the library's memory, valid while this "
+                                "object lives.")
+        .def_readonly("n_kt2s", &TMDShape::n_kt2s, "Number of kt2 knots")
+        .def_property_readonly(
+            "kt2_vec",
+            [](py::object self) { return VectorView(self.cast<const TMDShape &>().kt2_vec, self); },
+            "kt2 knots (GeV^2)")
+        .def_property_readonly(
+            "log_kt2_vec",
+            [](py::object self) {
+                return VectorView(self.cast<const TMDShape &>().log_kt2_vec, self);
+            },
+            "Natural logarithms of the kt2 knots")
+        .def_property_readonly(
+            "grid",
+            [](py::object self) {
+                const TMDShape &shape = self.cast<const TMDShape &>();
+                return ReadOnlyView(
+                    shape.grids_flat.data(),
+                    {static_cast<py::ssize_t>(shape.n_xs), static_cast<py::ssize_t>(shape.n_kt2s),
+                     static_cast<py::ssize_t>(shape.n_mu2s),
+                     static_cast<py::ssize_t>(shape.n_flavors)},
+                    {static_cast<py::ssize_t>(shape.stride_ix),
+                     static_cast<py::ssize_t>(shape.stride_ikt2),
+                     static_cast<py::ssize_t>(shape.stride_iq2), 1},
+                    self);
+            },
+            "grids_flat viewed with shape (n_xs, n_kt2s, n_mu2s, n_flavors); the values are "
+            "kt2 times the TMD, and the last axis follows pids.");
     // Bind ITMD
     py::class_<PDFxTMD::ITMD>(
         m, "ITMD",
@@ -185,7 +470,203 @@ PYBIND11_MODULE(pdfxtmd, m)
             "    output (list): A list of 13 floats to store TMD values for "
             "{tbar, bbar, cbar, sbar, ubar, dbar, g, d, u, s, c, b, t}.\n"
             "\nReturns:\n"
-            "    None: Modifies the output list in-place.");
+            "    None: Modifies the output list in-place.")
+        .def(
+            "tmd",
+            [](const PDFxTMD::ITMD &self, PDFxTMD::PartonFlavor flavor, const DoubleArray &x,
+               const DoubleArray &kt2, const DoubleArray &mu2, size_t nThreads) {
+                try
+                {
+                    const py::sequence points = Broadcast(x, kt2, mu2);
+                    const DoubleArray xs = Contiguous<double>(points[0]);
+                    const DoubleArray kt2s = Contiguous<double>(points[1]);
+                    const DoubleArray mu2s = Contiguous<double>(points[2]);
+                    const size_t n = static_cast<size_t>(xs.size());
+                    ValidatePoints(xs.data(), kt2s.data(), mu2s.data(), n);
+                    DoubleArray result(ShapeOf(xs));
+                    double *output = result.mutable_data();
+                    const double *xp = xs.data(), *kt2p = kt2s.data(), *mu2p = mu2s.data();
+                    {
+                        py::gil_scoped_release release;
+                        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t b, size_t e) {
+                            self.tmd(flavor, xp + b, kt2p + b, mu2p + b, output + b, e - b);
+                        });
+                    }
+                    return result;
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error("Error evaluating TMD for flavor " +
+                                          std::to_string(static_cast<int>(flavor)) +
+                                          " on arrays: " + e.what());
+                }
+            },
+            py::arg("flavor"), py::arg("x"), py::arg("kt2"), py::arg("mu2"),
+            py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate the TMD PDF for a specific parton flavor at many points.\n"
+            "\nArgs:\n"
+            "    flavor (PartonFlavor): The parton flavor (e.g., u, d, g).\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    kt2 (numpy.ndarray): Transverse momenta squared (GeV^2, non-negative).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    x, kt2 and mu2 are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray: The TMD PDF values, with the broadcast shape of the inputs.")
+        .def(
+            "tmd",
+            [](const PDFxTMD::ITMD &self, const FlavorArray &flavors, const DoubleArray &x,
+               const DoubleArray &kt2, const DoubleArray &mu2, size_t nThreads) {
+                try
+                {
+                    const py::sequence points = Broadcast(flavors, x, kt2, mu2);
+                    const FlavorArray flavorCodes = Contiguous<int>(points[0]);
+                    const DoubleArray xs = Contiguous<double>(points[1]);
+                    const DoubleArray kt2s = Contiguous<double>(points[2]);
+                    const DoubleArray mu2s = Contiguous<double>(points[3]);
+                    const size_t n = static_cast<size_t>(xs.size());
+                    ValidateFlavors(flavorCodes.data(), n);
+                    ValidatePoints(xs.data(), kt2s.data(), mu2s.data(), n);
+                    DoubleArray result(ShapeOf(xs));
+                    double *output = result.mutable_data();
+                    const int *flavor = flavorCodes.data();
+                    const double *xp = xs.data(), *kt2p = kt2s.data(), *mu2p = mu2s.data();
+                    {
+                        py::gil_scoped_release release;
+                        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t b, size_t e) {
+                            for (size_t i = b; i < e; ++i)
+                                output[i] =
+                                    self.tmd(static_cast<PDFxTMD::PartonFlavor>(flavor[i]), xp[i],
+                                             kt2p[i], mu2p[i]);
+                        });
+                    }
+                    return result;
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error evaluating TMD on arrays: ") +
+                                          e.what());
+                }
+            },
+            py::arg("flavors"), py::arg("x"), py::arg("kt2"), py::arg("mu2"),
+            py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate the TMD PDF at many points, with one parton flavor per point.\n"
+            "\nArgs:\n"
+            "    flavors (numpy.ndarray): PDG codes of the flavors (-6..6, 21 for the gluon).\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    kt2 (numpy.ndarray): Transverse momenta squared (GeV^2, non-negative).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    All arguments are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray: The TMD PDF values, with the broadcast shape of the inputs.")
+        .def(
+            "tmd",
+            [](const PDFxTMD::ITMD &self, const DoubleArray &x, const DoubleArray &kt2,
+               const DoubleArray &mu2, size_t nThreads) {
+                static_assert(sizeof(std::array<double, DEFAULT_TOTAL_PDFS>) ==
+                                  DEFAULT_TOTAL_PDFS * sizeof(double),
+                              "Rows of the result are filled as arrays of all flavors");
+                try
+                {
+                    const py::sequence points = Broadcast(x, kt2, mu2);
+                    const DoubleArray xs = Contiguous<double>(points[0]);
+                    const DoubleArray kt2s = Contiguous<double>(points[1]);
+                    const DoubleArray mu2s = Contiguous<double>(points[2]);
+                    const size_t n = static_cast<size_t>(xs.size());
+                    ValidatePoints(xs.data(), kt2s.data(), mu2s.data(), n);
+                    std::vector<py::ssize_t> shape = ShapeOf(xs);
+                    shape.push_back(DEFAULT_TOTAL_PDFS);
+                    DoubleArray result(shape);
+                    auto *output = reinterpret_cast<std::array<double, DEFAULT_TOTAL_PDFS> *>(
+                        result.mutable_data());
+                    const double *xp = xs.data(), *kt2p = kt2s.data(), *mu2p = mu2s.data();
+                    {
+                        py::gil_scoped_release release;
+                        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t b, size_t e) {
+                            self.tmd(xp + b, kt2p + b, mu2p + b, output + b, e - b);
+                        });
+                    }
+                    return result;
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(
+                        std::string("Error evaluating TMD for all flavors on arrays: ") +
+                        e.what());
+                }
+            },
+            py::arg("x"), py::arg("kt2"), py::arg("mu2"), py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate TMD PDFs for all flavors at many points.\n"
+            "\nArgs:\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    kt2 (numpy.ndarray): Transverse momenta squared (GeV^2, non-negative).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    x, kt2 and mu2 are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray: The broadcast shape of the inputs followed by 13 values for "
+            "{tbar, bbar, cbar, sbar, ubar, dbar, g, d, u, s, c, b, t}.")
+        .def(
+            "grid",
+            [](const PDFxTMD::ITMD &self) -> const TMDShape & {
+                try
+                {
+                    return PDFxTMD::withConcrete(self, [](const auto &pdf) -> const TMDShape & {
+                        return pdf.getReader().getData();
+                    });
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error accessing the TMD grid: ") +
+                                          e.what());
+                }
+            },
+            py::return_value_policy::reference_internal,
+            "The loaded knots and grid values, without copying them.\n"
+            "\nReturns:\n"
+            "    DefaultAllFlavorTMDShape: Read-only views, valid while this TMD lives.")
+        .def(
+            "coefficients",
+            [](py::object self) -> py::object {
+                try
+                {
+                    const PDFxTMD::ITMD &tmd = self.cast<const PDFxTMD::ITMD &>();
+                    return PDFxTMD::withConcrete(tmd, [&](const auto &pdf) -> py::object {
+                        using Interpolator = std::decay_t<decltype(pdf.getInterpolator())>;
+                        if constexpr (PDFxTMD::HasCoefficients<Interpolator>::value)
+                        {
+                            const TMDShape &shape = pdf.getReader().getData();
+                            const std::vector<py::ssize_t> gridShape = {
+                                static_cast<py::ssize_t>(shape.n_xs),
+                                static_cast<py::ssize_t>(shape.n_kt2s),
+                                static_cast<py::ssize_t>(shape.n_mu2s),
+                                static_cast<py::ssize_t>(shape.n_flavors), 8};
+                            std::vector<py::ssize_t> strides(gridShape.size(), 1);
+                            for (size_t axis = gridShape.size() - 1; axis > 0; --axis)
+                                strides[axis - 1] = strides[axis] * gridShape[axis];
+                            return ReadOnlyView(pdf.getInterpolator().getCoefficients().data(),
+                                                gridShape, strides, self);
+                        }
+                        else
+                            return py::none();
+                    });
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error accessing the TMD coefficients: ") +
+                                          e.what());
+                }
+            },
+            "The coefficient table precomputed by the interpolator, without copying it.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray or None: For TTricubicInterpolator, the read-only table of shape "
+            "(n_xs, n_kt2s, n_mu2s, n_flavors, 8) holding each grid value and its derivatives in "
+            "log x, log kt2 and log mu2 (slot bits 1, 2 and 4); None for interpolators without a "
+            "table.");
     // Bind ICPDF
     py::class_<PDFxTMD::ICPDF>(m, "ICPDF",
                                "Interface for Collinear Parton Distribution Functions (CPDFs)")
@@ -258,7 +739,194 @@ PYBIND11_MODULE(pdfxtmd, m)
             "    output (list): A list of 13 floats to store CPDF values for "
             "{tbar, bbar, cbar, sbar, ubar, dbar, g, d, u, s, c, b, t}.\n"
             "\nReturns:\n"
-            "    None: Modifies the output list in-place.");
+            "    None: Modifies the output list in-place.")
+        .def(
+            "pdf",
+            [](const PDFxTMD::ICPDF &self, PDFxTMD::PartonFlavor flavor, const DoubleArray &x,
+               const DoubleArray &mu2, size_t nThreads) {
+                try
+                {
+                    const py::sequence points = Broadcast(x, mu2);
+                    const DoubleArray xs = Contiguous<double>(points[0]);
+                    const DoubleArray mu2s = Contiguous<double>(points[1]);
+                    const size_t n = static_cast<size_t>(xs.size());
+                    ValidatePoints(xs.data(), nullptr, mu2s.data(), n);
+                    DoubleArray result(ShapeOf(xs));
+                    double *output = result.mutable_data();
+                    const double *xp = xs.data(), *mu2p = mu2s.data();
+                    {
+                        py::gil_scoped_release release;
+                        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t b, size_t e) {
+                            for (size_t i = b; i < e; ++i)
+                                output[i] = self.pdf(flavor, xp[i], mu2p[i]);
+                        });
+                    }
+                    return result;
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error("Error evaluating CPDF for flavor " +
+                                          std::to_string(static_cast<int>(flavor)) +
+                                          " on arrays: " + e.what());
+                }
+            },
+            py::arg("flavor"), py::arg("x"), py::arg("mu2"),
+            py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate the CPDF for a specific parton flavor at many points.\n"
+            "\nArgs:\n"
+            "    flavor (PartonFlavor): The parton flavor (e.g., u, d, g).\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    x and mu2 are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray: The CPDF values, with the broadcast shape of the inputs.")
+        .def(
+            "pdf",
+            [](const PDFxTMD::ICPDF &self, const FlavorArray &flavors, const DoubleArray &x,
+               const DoubleArray &mu2, size_t nThreads) {
+                try
+                {
+                    const py::sequence points = Broadcast(flavors, x, mu2);
+                    const FlavorArray flavorCodes = Contiguous<int>(points[0]);
+                    const DoubleArray xs = Contiguous<double>(points[1]);
+                    const DoubleArray mu2s = Contiguous<double>(points[2]);
+                    const size_t n = static_cast<size_t>(xs.size());
+                    ValidateFlavors(flavorCodes.data(), n);
+                    ValidatePoints(xs.data(), nullptr, mu2s.data(), n);
+                    DoubleArray result(ShapeOf(xs));
+                    double *output = result.mutable_data();
+                    const int *flavor = flavorCodes.data();
+                    const double *xp = xs.data(), *mu2p = mu2s.data();
+                    {
+                        py::gil_scoped_release release;
+                        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t b, size_t e) {
+                            for (size_t i = b; i < e; ++i)
+                                output[i] = self.pdf(static_cast<PDFxTMD::PartonFlavor>(flavor[i]),
+                                                     xp[i], mu2p[i]);
+                        });
+                    }
+                    return result;
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error evaluating CPDF on arrays: ") +
+                                          e.what());
+                }
+            },
+            py::arg("flavors"), py::arg("x"), py::arg("mu2"),
+            py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate the CPDF at many points, with one parton flavor per point.\n"
+            "\nArgs:\n"
+            "    flavors (numpy.ndarray): PDG codes of the flavors (-6..6, 21 for the gluon).\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    All arguments are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray: The CPDF values, with the broadcast shape of the inputs.")
+        .def(
+            "pdf",
+            [](const PDFxTMD::ICPDF &self, const DoubleArray &x, const DoubleArray &mu2,
+               size_t nThreads) {
+                try
+                {
+                    const py::sequence points = Broadcast(x, mu2);
+                    const DoubleArray xs = Contiguous<double>(points[0]);
+                    const DoubleArray mu2s = Contiguous<double>(points[1]);
+                    const size_t n = static_cast<size_t>(xs.size());
+                    ValidatePoints(xs.data(), nullptr, mu2s.data(), n);
+                    std::vector<py::ssize_t> shape = ShapeOf(xs);
+                    shape.push_back(DEFAULT_TOTAL_PDFS);
+                    DoubleArray result(shape);
+                    double *output = result.mutable_data();
+                    const double *xp = xs.data(), *mu2p = mu2s.data();
+                    {
+                        py::gil_scoped_release release;
+                        ParallelPoints(n, nThreads, MinPointsPerTask, [&](size_t b, size_t e) {
+                            std::array<double, DEFAULT_TOTAL_PDFS> values;
+                            for (size_t i = b; i < e; ++i)
+                            {
+                                self.pdf(xp[i], mu2p[i], values);
+                                std::copy(values.begin(), values.end(),
+                                          output + i * DEFAULT_TOTAL_PDFS);
+                            }
+                        });
+                    }
+                    return result;
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(
+                        std::string("Error evaluating CPDF for all flavors on arrays: ") +
+                        e.what());
+                }
+            },
+            py::arg("x"), py::arg("mu2"), py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate cPDFs for all flavors at many points.\n"
+            "\nArgs:\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    x and mu2 are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray: The broadcast shape of the inputs followed by 13 values for "
+            "{tbar, bbar, cbar, sbar, ubar, dbar, g, d, u, s, c, b, t}.")
+        .def(
+            "grid",
+            [](const PDFxTMD::ICPDF &self) -> const Shape & {
+                try
+                {
+                    return PDFxTMD::withConcrete(self, [](const auto &pdf) -> const Shape & {
+                        return pdf.getReader().getData();
+                    });
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error accessing the CPDF grid: ") +
+                                          e.what());
+                }
+            },
+            py::return_value_policy::reference_internal,
+            "The loaded knots and grid values, without copying them.\n"
+            "\nReturns:\n"
+            "    DefaultAllFlavorShape: Read-only views, valid while this CPDF lives.")
+        .def(
+            "coefficients",
+            [](py::object self) -> py::object {
+                try
+                {
+                    const PDFxTMD::ICPDF &cpdf = self.cast<const PDFxTMD::ICPDF &>();
+                    return PDFxTMD::withConcrete(cpdf, [&](const auto &pdf) -> py::object {
+                        using Interpolator = std::decay_t<decltype(pdf.getInterpolator())>;
+                        if constexpr (PDFxTMD::HasCoefficients<Interpolator>::value)
+                        {
+                            const Shape &shape = pdf.getReader().getData();
+                            const auto nMu2s = static_cast<py::ssize_t>(shape.n_mu2s);
+                            const auto nFlavors = static_cast<py::ssize_t>(shape.n_flavors);
+                            return ReadOnlyView(
+                                pdf.getInterpolator().getCoefficients().data(),
+                                {static_cast<py::ssize_t>(shape.n_xs) - 1, nMu2s, nFlavors, 4},
+                                {nMu2s * nFlavors * 4, nFlavors * 4, 4, 1}, self);
+                        }
+                        else
+                            return py::none();
+                    });
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(
+                        std::string("Error accessing the CPDF coefficients: ") + e.what());
+                }
+            },
+            "The coefficient table precomputed by the interpolator, without copying it.\n"
+            "\nReturns:\n"
+            "    numpy.ndarray or None: For the bicubic interpolator, the read-only polynomial "
+            "coefficients in log x of shape (n_xs - 1, n_mu2s, n_flavors, 4); None for "
+            "interpolators without a table.");
 
     py::class_<PDFxTMD::GenericCPDFFactory>(m, "GenericCPDFFactory",
                                             "Factory for creating CPDF objects")
@@ -436,6 +1104,23 @@ PYBIND11_MODULE(pdfxtmd, m)
                 }
             },
             py::arg("q2"), "Calculate alpha_s at scale Q^2.")
+        .def(
+            "alphasQ2",
+            [](const PDFxTMD::PDFSet<PDFxTMD::CollinearPDFTag> &self, const DoubleArray &q2,
+               size_t nThreads) {
+                try
+                {
+                    return AlphasQ2OnArray(self, q2, nThreads);
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error calculating alpha_s on arrays: ") +
+                                          e.what());
+                }
+            },
+            py::arg("q2"), py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate alpha_s at every scale Q^2 of an array, on n_threads threads (0 for all "
+            "hardware threads).")
         .def(
             "__getitem__",
             [](PDFxTMD::PDFSet<PDFxTMD::CollinearPDFTag> &self, int member) {
@@ -501,6 +1186,34 @@ PYBIND11_MODULE(pdfxtmd, m)
             },
             py::arg("values"), py::arg("cl") = -1,
             "Calculate uncertainty from a vector of PDF values.")
+        .def(
+            "Uncertainty",
+            [](PDFxTMD::PDFSet<PDFxTMD::CollinearPDFTag> &self, PDFxTMD::PartonFlavor flavor,
+               const DoubleArray &x, const DoubleArray &mu2, double cl, size_t nThreads) {
+                try
+                {
+                    return UncertaintyOnArrays(self, flavor, cl, nThreads, x, mu2);
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error("Error calculating uncertainty on arrays: " +
+                                          std::string(e.what()));
+                }
+            },
+            py::arg("flavor"), py::arg("x"), py::arg("mu2"), py::arg("cl") = -1,
+            py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate uncertainties for the specified flavor at many points.\n\n"
+            "Args:\n"
+            "    flavor (PartonFlavor): Parton flavor.\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    cl (float, optional): Confidence level percentage (-1 for default).\n"
+            "    x and mu2 are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n\n"
+            "Returns:\n"
+            "    dict: One array per PDFUncertainty field (central, errplus, errminus, ...), "
+            "with the broadcast shape of the inputs.")
         .def(
             "Correlation",
             [](PDFxTMD::PDFSet<PDFxTMD::CollinearPDFTag> &self, PDFxTMD::PartonFlavor flavorA,
@@ -600,6 +1313,23 @@ PYBIND11_MODULE(pdfxtmd, m)
                 }
             },
             py::arg("q2"), "Calculate alpha_s at scale Q^2.")
+        .def(
+            "alphasQ2",
+            [](const PDFxTMD::PDFSet<PDFxTMD::TMDPDFTag> &self, const DoubleArray &q2,
+               size_t nThreads) {
+                try
+                {
+                    return AlphasQ2OnArray(self, q2, nThreads);
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error(std::string("Error calculating alpha_s on arrays: ") +
+                                          e.what());
+                }
+            },
+            py::arg("q2"), py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate alpha_s at every scale Q^2 of an array, on n_threads threads (0 for all "
+            "hardware threads).")
         .def(
             "__getitem__",
             [](PDFxTMD::PDFSet<PDFxTMD::TMDPDFTag> &self, int member) {
@@ -669,6 +1399,36 @@ PYBIND11_MODULE(pdfxtmd, m)
             },
             py::arg("values"), py::arg("cl") = -1.0,
             "Calculate uncertainty from a vector of PDF values.")
+        .def(
+            "Uncertainty",
+            [](PDFxTMD::PDFSet<PDFxTMD::TMDPDFTag> &self, PDFxTMD::PartonFlavor flavor,
+               const DoubleArray &x, const DoubleArray &kt2, const DoubleArray &mu2, double cl,
+               size_t nThreads) {
+                try
+                {
+                    return UncertaintyOnArrays(self, flavor, cl, nThreads, x, kt2, mu2);
+                }
+                catch (const std::exception &e)
+                {
+                    throw py::value_error("Error calculating uncertainty on arrays: " +
+                                          std::string(e.what()));
+                }
+            },
+            py::arg("flavor"), py::arg("x"), py::arg("kt2"), py::arg("mu2"), py::arg("cl") = -1,
+            py::kw_only(), py::arg("n_threads") = 1,
+            "Calculate uncertainties for the specified flavor at many points.\n\n"
+            "Args:\n"
+            "    flavor (PartonFlavor): Parton flavor.\n"
+            "    x (numpy.ndarray): Momentum fractions (0 < x < 1).\n"
+            "    kt2 (numpy.ndarray): Transverse momenta squared (GeV^2, non-negative).\n"
+            "    mu2 (numpy.ndarray): Factorization scales squared (GeV^2, positive).\n"
+            "    cl (float, optional): Confidence level percentage (-1 for default).\n"
+            "    x, kt2 and mu2 are broadcast against each other as in NumPy.\n"
+            "    n_threads (int, keyword-only): Threads sharing the points, 0 for all hardware "
+            "threads. Default is 1.\n\n"
+            "Returns:\n"
+            "    dict: One array per PDFUncertainty field (central, errplus, errminus, ...), "
+            "with the broadcast shape of the inputs.")
         .def(
             "Correlation",
             [](PDFxTMD::PDFSet<PDFxTMD::TMDPDFTag> &self, PDFxTMD::PartonFlavor flavorA, double xA,